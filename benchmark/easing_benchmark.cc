@@ -0,0 +1,172 @@
+//
+//  easing_benchmark.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "takram/easing.h"
+
+namespace takram {
+namespace easing {
+
+namespace {
+
+template <class Function>
+void Evaluate(benchmark::State& state, Function function) {
+  std::vector<double> parameters(state.range(0));
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<double>(i) / (parameters.size() - 1);
+  }
+  for (auto _ : state) {
+    for (const auto parameter : parameters) {
+      benchmark::DoNotOptimize(function(parameter));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Function>
+void EvaluateBatch(benchmark::State& state, Function function) {
+  std::vector<double> parameters(state.range(0));
+  std::vector<double> results(state.range(0));
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<double>(i) / (parameters.size() - 1);
+  }
+  const Easing<double> easing(function);
+  for (auto _ : state) {
+    easing(parameters.data(), results.data(), parameters.size());
+    benchmark::DoNotOptimize(results.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+#define TAKRAM_EASING_BENCHMARK(Group, Inflection) \
+  BENCHMARK_CAPTURE(Evaluate, Group##Inflection, \
+                    Group<double>::Inflection)->Arg(1024); \
+  BENCHMARK_CAPTURE(EvaluateBatch, Group##Inflection, \
+                    Group<double>::Inflection)->Arg(1024);
+
+#define TAKRAM_EASING_BENCHMARK_GROUP(Group) \
+  TAKRAM_EASING_BENCHMARK(Group, In) \
+  TAKRAM_EASING_BENCHMARK(Group, Out) \
+  TAKRAM_EASING_BENCHMARK(Group, InOut)
+
+TAKRAM_EASING_BENCHMARK_GROUP(BackEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(BounceEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(CircularEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(CubicEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(ElasticEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(ExponentialEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(LinearEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(QuadraticEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(QuarticEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(QuinticEasing)
+TAKRAM_EASING_BENCHMARK_GROUP(SinusoidalEasing)
+
+#undef TAKRAM_EASING_BENCHMARK_GROUP
+#undef TAKRAM_EASING_BENCHMARK
+
+namespace {
+
+template <class Function>
+void EvaluateLookup(benchmark::State& state,
+                    Function function,
+                    Lookup<double>::Interpolation interpolation) {
+  const Lookup<double> lookup(function, state.range(1), interpolation);
+  std::vector<double> parameters(state.range(0));
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<double>(i) / (parameters.size() - 1);
+  }
+  for (auto _ : state) {
+    for (const auto parameter : parameters) {
+      benchmark::DoNotOptimize(lookup(parameter));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+#define TAKRAM_EASING_LOOKUP_BENCHMARK(Group, Inflection) \
+  BENCHMARK_CAPTURE(EvaluateLookup, Group##Inflection##Linear, \
+                    Group<double>::Inflection, \
+                    Lookup<double>::Interpolation::LINEAR) \
+      ->Args({1024, 256})->Args({1024, 4096}); \
+  BENCHMARK_CAPTURE(EvaluateLookup, Group##Inflection##Cubic, \
+                    Group<double>::Inflection, \
+                    Lookup<double>::Interpolation::CUBIC) \
+      ->Args({1024, 256})->Args({1024, 4096});
+
+TAKRAM_EASING_LOOKUP_BENCHMARK(CircularEasing, InOut)
+TAKRAM_EASING_LOOKUP_BENCHMARK(ElasticEasing, InOut)
+TAKRAM_EASING_LOOKUP_BENCHMARK(ExponentialEasing, InOut)
+TAKRAM_EASING_LOOKUP_BENCHMARK(SinusoidalEasing, InOut)
+
+#undef TAKRAM_EASING_LOOKUP_BENCHMARK
+
+namespace {
+
+void EvaluateBezier(benchmark::State& state) {
+  const Bezier<double> bezier(0.25, 0.1, 0.25, 1.0);
+  std::vector<double> parameters(state.range(0));
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<double>(i) / (parameters.size() - 1);
+  }
+  for (auto _ : state) {
+    for (const auto parameter : parameters) {
+      benchmark::DoNotOptimize(bezier(parameter));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void EvaluateBezierBatch(benchmark::State& state) {
+  const Bezier<double> bezier(0.25, 0.1, 0.25, 1.0);
+  std::vector<double> parameters(state.range(0));
+  std::vector<double> results(state.range(0));
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<double>(i) / (parameters.size() - 1);
+  }
+  const auto easing = bezier.easing();
+  for (auto _ : state) {
+    easing(parameters.data(), results.data(), parameters.size());
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(EvaluateBezier)->Arg(1024);
+BENCHMARK(EvaluateBezierBatch)->Arg(1024);
+
+}  // namespace easing
+}  // namespace takram
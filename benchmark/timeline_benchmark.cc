@@ -0,0 +1,198 @@
+//
+//  timeline_benchmark.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "takram/easing.h"
+#include "takram/tween.h"
+
+namespace takram {
+namespace tween {
+
+namespace {
+
+class Type {
+ public:
+  double value() const { return value_; }
+  void set_value(double value) { value_ = value; }
+
+ private:
+  double value_;
+};
+
+}  // namespace
+
+void AdvancePointers(benchmark::State& state) {
+  Timeline<Frame> timeline;
+  std::vector<double> values(state.range(0));
+  for (auto& value : values) {
+    timeline.tween(&value, 1.0, QuadraticEasing::InOut,
+                   Frame(INT64_C(1) << 40));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(timeline.advance());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(AdvancePointers)->Arg(1000)->Arg(10000)->Arg(100000);
+
+void AdvanceMixed(benchmark::State& state) {
+  Timeline<Frame> timeline;
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const Frame duration(INT64_C(1) << 40);
+  std::vector<double> values(count / 3);
+  std::vector<Type> objects(count / 3);
+  for (auto& value : values) {
+    timeline.tween(&value, 1.0, CubicEasing::Out, duration);
+  }
+  for (auto& object : objects) {
+    timeline.tween(&object, &Type::value, &Type::set_value, "value", 1.0,
+                   CubicEasing::Out, duration);
+  }
+  for (std::size_t i = 0; i < count - values.size() - objects.size(); ++i) {
+    timeline.timer(duration);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(timeline.advance());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(AdvanceMixed)->Arg(1000)->Arg(10000)->Arg(100000);
+
+void AdvanceParallel(benchmark::State& state) {
+  Timeline<Frame> timeline;
+  timeline.set_concurrency(state.range(1));
+  std::vector<double> values(state.range(0));
+  for (auto& value : values) {
+    timeline.tween(&value, 1.0, QuadraticEasing::InOut,
+                   Frame(INT64_C(1) << 40));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(timeline.advance());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(AdvanceParallel)
+    ->Args({100000, 2})
+    ->Args({100000, 4})
+    ->Args({100000, 8})
+    ->UseRealTime();
+
+void Seek(benchmark::State& state) {
+  Timeline<Frame> timeline;
+  const auto start = timeline.now();
+  const Frame duration(INT64_C(1) << 20);
+  std::vector<double> values(state.range(0));
+  for (auto& value : values) {
+    timeline.tween(&value, 1.0, QuadraticEasing::InOut, duration);
+  }
+  std::int64_t offset = 0;
+  for (auto _ : state) {
+    // Scrub back and forth across the tweens
+    offset = (offset + 7919) % duration.count();
+    benchmark::DoNotOptimize(timeline.seek(start + Frame(offset)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Seek)->Arg(10000)->Arg(100000);
+
+void AdvanceShared(benchmark::State& state) {
+  // Many small timelines advanced by their own clocks or a shared sample
+  std::vector<Timeline<Time>> timelines(state.range(0));
+  std::vector<double> values(timelines.size());
+  for (std::size_t i = 0; i < timelines.size(); ++i) {
+    timelines[i].tween(&values[i], 1.0, LinearEasing::In, Time(1e9));
+  }
+  Clock<Time> clock;
+  for (auto _ : state) {
+    if (state.range(1)) {
+      const auto now = clock.advance();
+      for (auto& timeline : timelines) {
+        benchmark::DoNotOptimize(timeline.advance(now));
+      }
+    } else {
+      for (auto& timeline : timelines) {
+        benchmark::DoNotOptimize(timeline.advance());
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(AdvanceShared)->Args({100, 0})->Args({100, 1});
+
+void ConstructTweens(benchmark::State& state) {
+  Timeline<Frame> timeline;
+  double value;
+  for (auto _ : state) {
+    Tween<Frame> tween(&value, 1.0, LinearEasing::In, Frame(60), &timeline);
+    benchmark::DoNotOptimize(tween);
+  }
+}
+BENCHMARK(ConstructTweens);
+
+void AddAndRemove(benchmark::State& state) {
+  Timeline<Frame> timeline;
+  std::vector<double> values(state.range(0));
+  std::vector<Tween<Frame>> tweens;
+  for (auto& value : values) {
+    tweens.emplace_back(timeline.tween(&value, 1.0, LinearEasing::In,
+                                       Frame(INT64_C(1) << 40)));
+  }
+  std::size_t index = 0;
+  for (auto _ : state) {
+    auto& tween = tweens[index];
+    tween.stop();
+    tween.start();
+    index = (index + 1) % tweens.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(AddAndRemove)->Arg(1000)->Arg(100000);
+
+void Churn(benchmark::State& state) {
+  Timeline<Frame> timeline;
+  std::vector<double> values(state.range(0));
+  std::size_t index = 0;
+  for (auto _ : state) {
+    // Tweens of random durations finish and get replaced every frame
+    for (std::size_t i = 0; i < values.size() / 10; ++i) {
+      timeline.tween(&values[index], 1.0, LinearEasing::In,
+                     Frame(index % 10 + 1));
+      index = (index + 1) % values.size();
+    }
+    benchmark::DoNotOptimize(timeline.advance());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) / 10);
+}
+BENCHMARK(Churn)->Arg(1000)->Arg(10000);
+
+}  // namespace tween
+}  // namespace takram
@@ -28,8 +28,13 @@
 #ifndef TAKRAM_EASING_H_
 #define TAKRAM_EASING_H_
 
+#include "takram/easing/bezier.h"
+#include "takram/easing/composition.h"
+#include "takram/easing/easing.h"
 #include "takram/easing/group.h"
 #include "takram/easing/inflector.h"
+#include "takram/easing/lookup.h"
+#include "takram/easing/packed.h"
 #include "takram/easing/preset.h"
 #include "takram/easing/reverse_inflector.h"
 #include "takram/easing/symmetric_inflector.h"
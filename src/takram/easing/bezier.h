@@ -0,0 +1,223 @@
+//
+//  takram/easing/bezier.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_EASING_BEZIER_H_
+#define TAKRAM_EASING_BEZIER_H_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+#include "takram/easing/easing.h"
+
+namespace takram {
+namespace easing {
+
+// Bezier is the easing of a cubic bezier curve from (0, 0) to (1, 1) with the
+// control points (x1, y1) and (x2, y2), as in CSS cubic-bezier(). It computes
+// the polynomial coefficients and a table of samples of x at construction,
+// and evaluates a parameter by solving x(t) for t with a few Newton
+// iterations from the tabulated guess, falling back to bisection where the
+// curve is too flat. Parameters are clamped to [0, 1]. The curve is shared by
+// copies of the bezier and the handles made by easing(), which keep it alive
+// after the bezier is destroyed and compare equal to each other.
+template <class T>
+class Bezier final {
+ public:
+  static constexpr const std::size_t resolution = 11;
+
+ private:
+  struct Curve {
+    T operator()(T parameter) const;
+    void operator()(const T *parameters, T *results, std::size_t count) const;
+    T x(T t) const { return ((ax * t + bx) * t + cx) * t; }
+    T y(T t) const { return ((ay * t + by) * t + cy) * t; }
+    T slope(T t) const { return (3.0 * ax * t + 2.0 * bx) * t + cx; }
+    T solve(T parameter) const;
+    T ax;
+    T bx;
+    T cx;
+    T ay;
+    T by;
+    T cy;
+    bool linear;
+    std::array<T, resolution> samples;
+  };
+
+  struct Shared {
+    std::shared_ptr<const Curve> curve;
+    T operator()(T parameter) const {
+      return (*curve)(parameter);
+    }
+    void operator()(const T *parameters, T *results, std::size_t count) const {
+      (*curve)(parameters, results, count);
+    }
+  };
+
+ public:
+  Bezier(T x1, T y1, T x2, T y2);
+
+  // Copy semantics
+  Bezier(const Bezier&) = default;
+  Bezier& operator=(const Bezier&) = default;
+
+  // Evaluation
+  T operator()(T parameter) const;
+  void operator()(const T *parameters, T *results, std::size_t count) const;
+
+  // Handle
+  Easing<T> easing() const { return easing_; }
+
+ private:
+  std::shared_ptr<const Curve> curve_;
+  Easing<T> easing_;
+};
+
+#pragma mark -
+
+template <class T>
+inline Bezier<T>::Bezier(T x1, T y1, T x2, T y2) {
+  assert(0.0 <= x1 && x1 <= 1.0);
+  assert(0.0 <= x2 && x2 <= 1.0);
+  const auto curve = std::make_shared<Curve>();
+  curve->cx = 3.0 * x1;
+  curve->bx = 3.0 * (x2 - x1) - curve->cx;
+  curve->ax = 1.0 - curve->cx - curve->bx;
+  curve->cy = 3.0 * y1;
+  curve->by = 3.0 * (y2 - y1) - curve->cy;
+  curve->ay = 1.0 - curve->cy - curve->by;
+  curve->linear = x1 == y1 && x2 == y2;
+  const T last = resolution - 1;
+  for (std::size_t i = 0; i < resolution; ++i) {
+    curve->samples[i] = curve->x(i / last);
+  }
+  curve_ = curve;
+  easing_ = Shared{curve_};
+}
+
+#pragma mark Evaluation
+
+template <class T>
+inline T Bezier<T>::operator()(T parameter) const {
+  return (*curve_)(parameter);
+}
+
+template <class T>
+inline void Bezier<T>::operator()(const T *parameters,
+                                  T *results,
+                                  std::size_t count) const {
+  (*curve_)(parameters, results, count);
+}
+
+template <class T>
+inline T Bezier<T>::Curve::operator()(T parameter) const {
+  const auto clamped = std::min(std::max(parameter, T(0)), T(1));
+  if (linear) {
+    return clamped;
+  }
+  return y(solve(clamped));
+}
+
+template <class T>
+inline void Bezier<T>::Curve::operator()(const T *parameters,
+                                         T *results,
+                                         std::size_t count) const {
+  if (linear) {
+    for (std::size_t i = 0; i < count; ++i) {
+      results[i] = std::min(std::max(parameters[i], T(0)), T(1));
+    }
+  } else {
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto clamped = std::min(std::max(parameters[i], T(0)), T(1));
+      results[i] = y(solve(clamped));
+    }
+  }
+}
+
+template <class T>
+inline T Bezier<T>::Curve::solve(T parameter) const {
+  constexpr const int newton_iterations = 4;
+  constexpr const int bisection_iterations = 32;
+  constexpr const T minimum_slope = 1.0e-3;
+  // Scale the precision to that of the type, for float cannot resolve errors
+  // much smaller than its epsilon around 1
+  constexpr const T precision = std::max<T>(
+      1.0e-9, 4 * std::numeric_limits<T>::epsilon());
+
+  // Find the interval of samples containing the parameter, and interpolate
+  // linearly between them for the initial guess. x(t) is monotonic because
+  // the control points lie in [0, 1] horizontally.
+  const T step = 1.0 / (resolution - 1);
+  std::size_t index = 0;
+  while (index < resolution - 2 && samples[index + 1] <= parameter) {
+    ++index;
+  }
+  const auto from = samples[index];
+  const auto to = samples[index + 1];
+  T lower = step * index;
+  T upper = lower + step;
+  T t = lower + (to > from ? step * (parameter - from) / (to - from) : 0.0);
+
+  // Newton's method converges in a few iterations unless the curve is flat
+  for (int i = 0; i < newton_iterations; ++i) {
+    const auto error = x(t) - parameter;
+    if (std::abs(error) < precision) {
+      return t;
+    }
+    const auto derivative = slope(t);
+    if (std::abs(derivative) < minimum_slope) {
+      break;
+    }
+    t -= error / derivative;
+  }
+  if (lower <= t && t <= upper && std::abs(x(t) - parameter) < precision) {
+    return t;
+  }
+  t = (lower + upper) / 2.0;
+  for (int i = 0; i < bisection_iterations; ++i) {
+    const auto error = x(t) - parameter;
+    if (std::abs(error) < precision) {
+      break;
+    }
+    if (error > 0.0) {
+      upper = t;
+    } else {
+      lower = t;
+    }
+    t = (lower + upper) / 2.0;
+  }
+  return t;
+}
+
+}  // namespace easing
+}  // namespace takram
+
+#endif  // TAKRAM_EASING_BEZIER_H_
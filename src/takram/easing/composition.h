@@ -0,0 +1,215 @@
+//
+//  takram/easing/composition.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_EASING_COMPOSITION_H_
+#define TAKRAM_EASING_COMPOSITION_H_
+
+namespace takram {
+namespace easing {
+
+// The compositions below wrap easing functions by value and evaluate them in
+// constexpr call operators, so that chains of statically known easings are
+// inlined into straight-line code, and can be evaluated in constant
+// expressions when the wrapped functions can. The free functions deduce T
+// from the Value type of the first function, which the inflectors in Group
+// and the compositions themselves provide.
+//
+// Converting a composition to Easing stores it inside the handle when it fits
+// in two pointers, as a single composition of presets does. Nested ones are
+// larger, and the handle moves them to a shared allocation instead, which is
+// copied by reference but costs an allocation when the handle is made.
+
+// Sequence evaluates the first function over [0, split) and the second over
+// [split, 1], each scaled to meet at the split point, which must lie in
+// (0, 1). The sequence of In and Out split at 0.5 is equivalent to InOut.
+template <class T, class First, class Second>
+class Sequence final {
+ public:
+  using Value = T;
+
+ public:
+  constexpr Sequence(const First& first, const Second& second, T split = 0.5)
+      : first_(first),
+        second_(second),
+        split_(split) {}
+
+  // Evaluation
+  constexpr T operator()(T parameter) const;
+
+ private:
+  First first_;
+  Second second_;
+  T split_;
+};
+
+// Blend interpolates between the results of two functions by a fixed weight.
+template <class T, class First, class Second>
+class Blend final {
+ public:
+  using Value = T;
+
+ public:
+  constexpr Blend(const First& first, const Second& second, T weight = 0.5)
+      : first_(first),
+        second_(second),
+        weight_(weight) {}
+
+  // Evaluation
+  constexpr T operator()(T parameter) const;
+
+ private:
+  First first_;
+  Second second_;
+  T weight_;
+};
+
+// Mirror reflects a function about the center, which turns an ease-in into
+// the corresponding ease-out and vice versa.
+template <class T, class Function>
+class Mirror final {
+ public:
+  using Value = T;
+
+ public:
+  explicit constexpr Mirror(const Function& function) : function_(function) {}
+
+  // Evaluation
+  constexpr T operator()(T parameter) const;
+
+ private:
+  Function function_;
+};
+
+// Scale speeds a function up by a factor, holding its end value once the
+// scaled parameter reaches 1.
+template <class T, class Function>
+class Scale final {
+ public:
+  using Value = T;
+
+ public:
+  constexpr Scale(const Function& function, T factor)
+      : function_(function),
+        factor_(factor) {}
+
+  // Evaluation
+  constexpr T operator()(T parameter) const;
+
+ private:
+  Function function_;
+  T factor_;
+};
+
+// Clamp limits the results of a function to [0, 1], which removes overshoots
+// of functions like back and elastic easings.
+template <class T, class Function>
+class Clamp final {
+ public:
+  using Value = T;
+
+ public:
+  explicit constexpr Clamp(const Function& function) : function_(function) {}
+
+  // Evaluation
+  constexpr T operator()(T parameter) const;
+
+ private:
+  Function function_;
+};
+
+template <class First, class Second>
+constexpr Sequence<typename First::Value, First, Second> sequence(
+    const First& first,
+    const Second& second,
+    typename First::Value split = 0.5) {
+  return Sequence<typename First::Value, First, Second>(first, second, split);
+}
+
+template <class First, class Second>
+constexpr Blend<typename First::Value, First, Second> blend(
+    const First& first,
+    const Second& second,
+    typename First::Value weight = 0.5) {
+  return Blend<typename First::Value, First, Second>(first, second, weight);
+}
+
+template <class Function>
+constexpr Mirror<typename Function::Value, Function> mirror(
+    const Function& function) {
+  return Mirror<typename Function::Value, Function>(function);
+}
+
+template <class Function>
+constexpr Scale<typename Function::Value, Function> scale(
+    const Function& function,
+    typename Function::Value factor) {
+  return Scale<typename Function::Value, Function>(function, factor);
+}
+
+template <class Function>
+constexpr Clamp<typename Function::Value, Function> clamp(
+    const Function& function) {
+  return Clamp<typename Function::Value, Function>(function);
+}
+
+#pragma mark -
+
+template <class T, class First, class Second>
+constexpr T Sequence<T, First, Second>::operator()(T parameter) const {
+  return parameter < split_ ?
+      split_ * first_(parameter / split_) :
+      split_ + (1.0 - split_) *
+          second_((parameter - split_) / (1.0 - split_));
+}
+
+template <class T, class First, class Second>
+constexpr T Blend<T, First, Second>::operator()(T parameter) const {
+  return (1.0 - weight_) * first_(parameter) + weight_ * second_(parameter);
+}
+
+template <class T, class Function>
+constexpr T Mirror<T, Function>::operator()(T parameter) const {
+  return 1.0 - function_(1.0 - parameter);
+}
+
+template <class T, class Function>
+constexpr T Scale<T, Function>::operator()(T parameter) const {
+  return parameter * factor_ < 1.0 ?
+      function_(parameter * factor_) :
+      function_(1.0);
+}
+
+template <class T, class Function>
+constexpr T Clamp<T, Function>::operator()(T parameter) const {
+  const T value = function_(parameter);
+  return value < 0.0 ? 0.0 : (value > 1.0 ? 1.0 : value);
+}
+
+}  // namespace easing
+}  // namespace takram
+
+#endif  // TAKRAM_EASING_COMPOSITION_H_
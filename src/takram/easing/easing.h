@@ -0,0 +1,380 @@
+//
+//  takram/easing/easing.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_EASING_EASING_H_
+#define TAKRAM_EASING_EASING_H_
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace takram {
+namespace easing {
+
+// Easing is a handle to an easing function. Trivially copyable callables of up
+// to two pointers, which include the presets, function pointers and small
+// lambdas, are stored inside the handle itself, so copying them never
+// allocates. Other callables, such as lambdas capturing a std::shared_ptr or
+// std::function objects, are moved to a reference-counted slot on the heap
+// that copies of the handle share. Either way the callable is invoked through
+// a single function pointer that also evaluates ranges of parameters at once.
+// Handles that were made of the same inline callable, or copied from the same
+// handle, compare equal, which lets callers group and batch over easings.
+// Only the bytes of the stored callable take part in the comparison.
+template <class T>
+class Easing final {
+ public:
+  using Value = T;
+  static constexpr const std::size_t capacity = 2 * sizeof(void *);
+
+ private:
+  using Function = void (*)(const void *storage,
+                            const T *parameters,
+                            T *results,
+                            std::size_t count);
+
+  // Heap slot of a callable that is not stored inline
+  struct Slot {
+    explicit Slot(void (*destroy)(Slot *slot))
+        : references(1), destroy(destroy) {}
+    std::atomic<std::size_t> references;
+    void (*destroy)(Slot *slot);
+  };
+
+  template <class Callable>
+  struct Holder : Slot {
+    explicit Holder(const Callable& callable);
+    Callable callable;
+  };
+
+  template <class Callable>
+  using IsInline = std::integral_constant<bool,
+    std::is_trivially_copyable<Callable>::value &&
+    sizeof(Callable) <= capacity &&
+    alignof(void *) % alignof(Callable) == 0
+  >;
+
+  template <class Callable>
+  using EnableIfCallable = typename std::enable_if<
+    !std::is_same<typename std::decay<Callable>::type, Easing>::value &&
+    std::is_convertible<
+      decltype(std::declval<Callable&>()(std::declval<T>())), T
+    >::value
+  >::type;
+
+ public:
+  Easing();
+  template <class Callable, class = EnableIfCallable<Callable>>
+  Easing(const Callable& callable);  // Intentionally implicit
+
+  ~Easing();
+
+  // Copy semantics
+  Easing(const Easing& other) noexcept;
+  Easing& operator=(const Easing& other) noexcept;
+
+  // Move semantics
+  Easing(Easing&& other) noexcept;
+  Easing& operator=(Easing&& other) noexcept;
+
+  // Comparison
+  bool operator==(const Easing& other) const;
+  bool operator!=(const Easing& other) const;
+
+  // Evaluation
+  T operator()(T parameter) const;
+  void operator()(const T *parameters, T *results, std::size_t count) const;
+
+  // Conversion
+  explicit operator bool() const { return function_; }
+
+ private:
+  template <class Callable>
+  void construct(const Callable& callable, std::true_type);
+  template <class Callable>
+  void construct(const Callable& callable, std::false_type);
+  void retain() const noexcept;
+  void release() noexcept;
+
+  template <class Callable>
+  static void invoke(const void *storage,
+                     const T *parameters,
+                     T *results,
+                     std::size_t count);
+  template <class Callable>
+  static void invoke(Callable& callable,
+                     const T *parameters,
+                     T *results,
+                     std::size_t count,
+                     std::true_type);
+  template <class Callable>
+  static void invoke(Callable& callable,
+                     const T *parameters,
+                     T *results,
+                     std::size_t count,
+                     std::false_type);
+  template <class Callable>
+  static void invoke_slot(const void *storage,
+                          const T *parameters,
+                          T *results,
+                          std::size_t count);
+  template <class Callable>
+  static void destroy(Slot *slot);
+
+ private:
+  Function function_;
+  Slot *slot_;
+  std::size_t size_;
+  alignas(void *) unsigned char storage_[capacity];
+};
+
+// Whether the callable has an overload that evaluates a range of parameters
+template <class Callable, class T, class = void>
+struct IsBatchCallable : std::false_type {};
+
+template <class Callable, class T>
+struct IsBatchCallable<Callable, T, decltype(void(
+    std::declval<Callable&>()(std::declval<const T *>(),
+                              std::declval<T *>(),
+                              std::declval<std::size_t>())))>
+    : std::true_type {};
+
+#pragma mark -
+
+template <class T>
+inline Easing<T>::Easing() : function_(), slot_(), size_(), storage_() {}
+
+template <class T>
+template <class Callable, class>
+inline Easing<T>::Easing(const Callable& callable)
+    : function_(),
+      slot_(),
+      size_(),
+      storage_() {
+  using Stored = typename std::decay<Callable>::type;
+  construct<Stored>(callable, IsInline<Stored>());
+}
+
+template <class T>
+inline Easing<T>::~Easing() {
+  release();
+}
+
+template <class T>
+template <class Callable>
+inline Easing<T>::Holder<Callable>::Holder(const Callable& callable)
+    : Slot(&Easing::destroy<Callable>),
+      callable(callable) {}
+
+template <class T>
+template <class Callable>
+inline void Easing<T>::construct(const Callable& callable, std::true_type) {
+  function_ = &invoke<Callable>;
+  size_ = sizeof(Callable);
+  // Copy the object representation, which trivially copyable callables allow,
+  // so that the bytes compared are exactly those of the callable given
+  std::memcpy(storage_, &callable, sizeof(Callable));
+}
+
+template <class T>
+template <class Callable>
+inline void Easing<T>::construct(const Callable& callable, std::false_type) {
+  const auto holder = new Holder<Callable>(callable);
+  function_ = &invoke_slot<Callable>;
+  slot_ = holder;
+  size_ = sizeof(const Callable *);
+  // Keep the address of the callable inline so that evaluation and comparison
+  // do not depend on where the callable is stored
+  const Callable *pointer = &holder->callable;
+  std::memcpy(storage_, &pointer, sizeof(pointer));
+}
+
+#pragma mark Copy and move semantics
+
+template <class T>
+inline Easing<T>::Easing(const Easing& other) noexcept
+    : function_(other.function_),
+      slot_(other.slot_),
+      size_(other.size_) {
+  std::memcpy(storage_, other.storage_, capacity);
+  retain();
+}
+
+template <class T>
+inline Easing<T>& Easing<T>::operator=(const Easing& other) noexcept {
+  if (&other != this) {
+    other.retain();
+    release();
+    function_ = other.function_;
+    slot_ = other.slot_;
+    size_ = other.size_;
+    std::memcpy(storage_, other.storage_, capacity);
+  }
+  return *this;
+}
+
+template <class T>
+inline Easing<T>::Easing(Easing&& other) noexcept
+    : function_(other.function_),
+      slot_(other.slot_),
+      size_(other.size_) {
+  std::memcpy(storage_, other.storage_, capacity);
+  other.function_ = nullptr;
+  other.slot_ = nullptr;
+  other.size_ = 0;
+}
+
+template <class T>
+inline Easing<T>& Easing<T>::operator=(Easing&& other) noexcept {
+  if (&other != this) {
+    release();
+    function_ = other.function_;
+    slot_ = other.slot_;
+    size_ = other.size_;
+    std::memcpy(storage_, other.storage_, capacity);
+    other.function_ = nullptr;
+    other.slot_ = nullptr;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <class T>
+inline void Easing<T>::retain() const noexcept {
+  if (slot_) {
+    slot_->references.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+template <class T>
+inline void Easing<T>::release() noexcept {
+  if (slot_ &&
+      slot_->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    slot_->destroy(slot_);
+  }
+  slot_ = nullptr;
+}
+
+template <class T>
+template <class Callable>
+inline void Easing<T>::destroy(Slot *slot) {
+  delete static_cast<Holder<Callable> *>(slot);
+}
+
+#pragma mark Comparison
+
+template <class T>
+inline bool Easing<T>::operator==(const Easing& other) const {
+  // Handles with the same function store callables of the same type and size
+  return (function_ == other.function_ &&
+          !std::memcmp(storage_, other.storage_, size_));
+}
+
+template <class T>
+inline bool Easing<T>::operator!=(const Easing& other) const {
+  return !operator==(other);
+}
+
+#pragma mark Evaluation
+
+template <class T>
+inline T Easing<T>::operator()(T parameter) const {
+  assert(function_);
+  T result;
+  function_(storage_, &parameter, &result, 1);
+  return result;
+}
+
+template <class T>
+inline void Easing<T>::operator()(const T *parameters,
+                                  T *results,
+                                  std::size_t count) const {
+  assert(function_);
+  function_(storage_, parameters, results, count);
+}
+
+template <class T>
+template <class Callable>
+inline void Easing<T>::invoke(const void *storage,
+                              const T *parameters,
+                              T *results,
+                              std::size_t count) {
+  // Evaluate against a copy because callables are not required to have const
+  // call operators, which is cheap for trivially copyable callables.
+  Callable callable(*static_cast<const Callable *>(storage));
+  invoke(callable, parameters, results, count,
+         IsBatchCallable<Callable, T>());
+}
+
+template <class T>
+template <class Callable>
+inline void Easing<T>::invoke_slot(const void *storage,
+                                   const T *parameters,
+                                   T *results,
+                                   std::size_t count) {
+  // Callables in slots are shared by the copies of the handle, and are not
+  // copied for evaluation as they may allocate, like std::function does
+  Callable *callable;
+  std::memcpy(&callable, storage, sizeof(callable));
+  invoke(*callable, parameters, results, count,
+         IsBatchCallable<Callable, T>());
+}
+
+template <class T>
+template <class Callable>
+inline void Easing<T>::invoke(Callable& callable,
+                              const T *parameters,
+                              T *results,
+                              std::size_t count,
+                              std::true_type) {
+  if (count == 1) {
+    *results = callable(*parameters);
+  } else {
+    callable(parameters, results, count);
+  }
+}
+
+template <class T>
+template <class Callable>
+inline void Easing<T>::invoke(Callable& callable,
+                              const T *parameters,
+                              T *results,
+                              std::size_t count,
+                              std::false_type) {
+  for (std::size_t i = 0; i < count; ++i) {
+    results[i] = callable(parameters[i]);
+  }
+}
+
+}  // namespace easing
+}  // namespace takram
+
+#endif  // TAKRAM_EASING_EASING_H_
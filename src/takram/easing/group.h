@@ -28,8 +28,6 @@
 #ifndef TAKRAM_EASING_GROUP_H_
 #define TAKRAM_EASING_GROUP_H_
 
-#include <functional>
-
 #include "takram/easing/inflector.h"
 #include "takram/easing/reverse_inflector.h"
 #include "takram/easing/symmetric_inflector.h"
@@ -39,19 +37,19 @@ namespace easing {
 
 template <class T, template <class = T> class Function>
 struct Group {
-  static Inflector<T, Function> In;
-  static ReverseInflector<T, Function> Out;
-  static SymmetricInflector<T, Function> InOut;
+  static constexpr const Inflector<T, Function> In{};
+  static constexpr const ReverseInflector<T, Function> Out{};
+  static constexpr const SymmetricInflector<T, Function> InOut{};
 };
 
 #pragma mark -
 
 template <class T, template <class> class Function>
-Inflector<T, Function> Group<T, Function>::In;
+constexpr const Inflector<T, Function> Group<T, Function>::In;
 template <class T, template <class> class Function>
-ReverseInflector<T, Function> Group<T, Function>::Out;
+constexpr const ReverseInflector<T, Function> Group<T, Function>::Out;
 template <class T, template <class> class Function>
-SymmetricInflector<T, Function> Group<T, Function>::InOut;
+constexpr const SymmetricInflector<T, Function> Group<T, Function>::InOut;
 
 }  // namespace easing
 }  // namespace takram
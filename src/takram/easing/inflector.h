@@ -28,21 +28,38 @@
 #ifndef TAKRAM_EASING_INFLECTOR_H_
 #define TAKRAM_EASING_INFLECTOR_H_
 
+#include <cstddef>
+
+#include "takram/easing/packed.h"
+
 namespace takram {
 namespace easing {
 
 template <class T, template <class = T> class Function>
 struct Inflector {
-  T operator()(T parameter);
+  using Value = T;
+  constexpr T operator()(T parameter) const;
+  void operator()(const T *parameters, T *results, std::size_t count) const;
 };
 
 #pragma mark -
 
 template <class T, template <class> class Function>
-inline T Inflector<T, Function>::operator()(T parameter) {
+constexpr T Inflector<T, Function>::operator()(T parameter) const {
   return Function<T>()(parameter);
 }
 
+template <class T, template <class> class Function>
+inline void Inflector<T, Function>::operator()(
+    const T *parameters,
+    T *results,
+    std::size_t count) const {
+  EvaluatePacked<Function<T>>(parameters, results, count, *this,
+      [](const auto& parameter) {
+        return Function<T>()(parameter);
+      });
+}
+
 }  // namespace easing
 }  // namespace takram
 
@@ -0,0 +1,186 @@
+//
+//  takram/easing/lookup.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_EASING_LOOKUP_H_
+#define TAKRAM_EASING_LOOKUP_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "takram/easing/easing.h"
+
+namespace takram {
+namespace easing {
+
+// Lookup bakes an easing function into a table of samples at construction,
+// and evaluates it by interpolating between the samples, trading accuracy for
+// speed of expensive functions. Parameters are clamped to [0, 1]. The table is
+// shared by copies of the lookup and the handles made by easing(), which keep
+// it alive after the lookup is destroyed and compare equal to each other.
+template <class T>
+class Lookup final {
+ public:
+  enum class Interpolation { LINEAR, CUBIC };
+
+ private:
+  struct Table {
+    T operator()(T parameter) const;
+    void operator()(const T *parameters, T *results, std::size_t count) const;
+    T linear(T parameter) const;
+    T cubic(T parameter) const;
+    std::vector<T> samples;
+    Interpolation interpolation;
+  };
+
+  struct Shared {
+    std::shared_ptr<const Table> table;
+    T operator()(T parameter) const {
+      return (*table)(parameter);
+    }
+    void operator()(const T *parameters, T *results, std::size_t count) const {
+      (*table)(parameters, results, count);
+    }
+  };
+
+ public:
+  template <class Function>
+  explicit Lookup(Function function,
+                  std::size_t resolution = 1024,
+                  Interpolation interpolation = Interpolation::LINEAR);
+
+  // Copy semantics
+  Lookup(const Lookup&) = default;
+  Lookup& operator=(const Lookup&) = default;
+
+  // Evaluation
+  T operator()(T parameter) const;
+  void operator()(const T *parameters, T *results, std::size_t count) const;
+
+  // Handle
+  Easing<T> easing() const { return easing_; }
+
+  // Attributes
+  std::size_t resolution() const { return table_->samples.size(); }
+  Interpolation interpolation() const { return table_->interpolation; }
+
+ private:
+  std::shared_ptr<const Table> table_;
+  Easing<T> easing_;
+};
+
+#pragma mark -
+
+template <class T>
+template <class Function>
+inline Lookup<T>::Lookup(Function function,
+                         std::size_t resolution,
+                         Interpolation interpolation) {
+  assert(resolution > 1);
+  const auto table = std::make_shared<Table>();
+  table->samples.resize(resolution);
+  table->interpolation = interpolation;
+  const auto last = static_cast<T>(resolution - 1);
+  for (std::size_t i = 0; i < resolution; ++i) {
+    table->samples[i] = function(static_cast<T>(i) / last);
+  }
+  table_ = table;
+  easing_ = Shared{table_};
+}
+
+#pragma mark Evaluation
+
+template <class T>
+inline T Lookup<T>::operator()(T parameter) const {
+  return (*table_)(parameter);
+}
+
+template <class T>
+inline void Lookup<T>::operator()(const T *parameters,
+                                  T *results,
+                                  std::size_t count) const {
+  (*table_)(parameters, results, count);
+}
+
+template <class T>
+inline T Lookup<T>::Table::operator()(T parameter) const {
+  if (interpolation == Interpolation::CUBIC) {
+    return cubic(parameter);
+  }
+  return linear(parameter);
+}
+
+template <class T>
+inline void Lookup<T>::Table::operator()(const T *parameters,
+                                         T *results,
+                                         std::size_t count) const {
+  if (interpolation == Interpolation::CUBIC) {
+    for (std::size_t i = 0; i < count; ++i) {
+      results[i] = cubic(parameters[i]);
+    }
+  } else {
+    for (std::size_t i = 0; i < count; ++i) {
+      results[i] = linear(parameters[i]);
+    }
+  }
+}
+
+template <class T>
+inline T Lookup<T>::Table::linear(T parameter) const {
+  const auto last = samples.size() - 1;
+  const auto position = std::min(std::max(parameter, T(0)), T(1)) * last;
+  const auto index = std::min(static_cast<std::size_t>(position), last - 1);
+  const auto fraction = position - static_cast<T>(index);
+  const auto a = samples[index];
+  const auto b = samples[index + 1];
+  return a + (b - a) * fraction;
+}
+
+template <class T>
+inline T Lookup<T>::Table::cubic(T parameter) const {
+  // Catmull-Rom spline through the samples, extrapolating linearly past the
+  // end samples so that the end tangents follow the curve
+  const auto last = samples.size() - 1;
+  const auto position = std::min(std::max(parameter, T(0)), T(1)) * last;
+  const auto index = std::min(static_cast<std::size_t>(position), last - 1);
+  const auto t = position - static_cast<T>(index);
+  const auto p1 = samples[index];
+  const auto p2 = samples[index + 1];
+  const auto p0 = index ? samples[index - 1] : T(2) * p1 - p2;
+  const auto p3 = index + 2 <= last ? samples[index + 2] : T(2) * p2 - p1;
+  return p1 + T(0.5) * t * (
+      (p2 - p0) + t * (
+          (T(2) * p0 - T(5) * p1 + T(4) * p2 - p3) + t * (
+              T(3) * (p1 - p2) + p3 - p0)));
+}
+
+}  // namespace easing
+}  // namespace takram
+
+#endif  // TAKRAM_EASING_LOOKUP_H_
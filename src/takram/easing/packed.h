@@ -0,0 +1,353 @@
+//
+//  takram/easing/packed.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_EASING_PACKED_H_
+#define TAKRAM_EASING_PACKED_H_
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX__)
+#define TAKRAM_EASING_PACKED_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TAKRAM_EASING_PACKED_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace takram {
+namespace easing {
+
+// Packed<T> holds as many values of T as fit in a SIMD register, and provides
+// the arithmetic that is needed to evaluate polynomial easings. The primary
+// template is a scalar fallback holding a single value.
+template <class T>
+class Packed final {
+ public:
+  using Value = T;
+  static constexpr const std::size_t width = 1;
+
+ public:
+  Packed() : value_() {}
+  Packed(T value) : value_(value) {}  // Intentionally implicit
+
+  // Memory
+  static Packed load(const T *data) { return Packed(*data); }
+  void store(T *data) const { *data = value_; }
+
+  // Arithmetic
+  friend Packed operator+(const Packed& a, const Packed& b) {
+    return a.value_ + b.value_;
+  }
+  friend Packed operator-(const Packed& a, const Packed& b) {
+    return a.value_ - b.value_;
+  }
+  friend Packed operator*(const Packed& a, const Packed& b) {
+    return a.value_ * b.value_;
+  }
+  friend Packed operator/(const Packed& a, const Packed& b) {
+    return a.value_ / b.value_;
+  }
+
+  // Comparison, which results in a mask for Select()
+  friend Packed operator<(const Packed& a, const Packed& b) {
+    return a.value_ < b.value_ ? 1 : 0;
+  }
+
+  // Functions
+  friend Packed Select(const Packed& mask, const Packed& a, const Packed& b) {
+    return mask.value_ ? a : b;
+  }
+  friend Packed Sqrt(const Packed& a) {
+    return std::sqrt(a.value_);
+  }
+
+ private:
+  T value_;
+};
+
+#if defined(TAKRAM_EASING_PACKED_AVX)
+
+template <>
+class Packed<double> final {
+ public:
+  using Value = double;
+  static constexpr const std::size_t width = 4;
+
+ public:
+  Packed() : value_(_mm256_setzero_pd()) {}
+  Packed(double value) : value_(_mm256_set1_pd(value)) {}
+  Packed(__m256d value) : value_(value) {}
+
+  // Memory
+  static Packed load(const double *data) { return _mm256_loadu_pd(data); }
+  void store(double *data) const { _mm256_storeu_pd(data, value_); }
+
+  // Arithmetic
+  friend Packed operator+(const Packed& a, const Packed& b) {
+    return _mm256_add_pd(a.value_, b.value_);
+  }
+  friend Packed operator-(const Packed& a, const Packed& b) {
+    return _mm256_sub_pd(a.value_, b.value_);
+  }
+  friend Packed operator*(const Packed& a, const Packed& b) {
+    return _mm256_mul_pd(a.value_, b.value_);
+  }
+  friend Packed operator/(const Packed& a, const Packed& b) {
+    return _mm256_div_pd(a.value_, b.value_);
+  }
+
+  // Comparison, which results in a mask for Select()
+  friend Packed operator<(const Packed& a, const Packed& b) {
+    return _mm256_cmp_pd(a.value_, b.value_, _CMP_LT_OQ);
+  }
+
+  // Functions
+  friend Packed Select(const Packed& mask, const Packed& a, const Packed& b) {
+    return _mm256_blendv_pd(b.value_, a.value_, mask.value_);
+  }
+  friend Packed Sqrt(const Packed& a) {
+    return _mm256_sqrt_pd(a.value_);
+  }
+
+ private:
+  __m256d value_;
+};
+
+template <>
+class Packed<float> final {
+ public:
+  using Value = float;
+  static constexpr const std::size_t width = 8;
+
+ public:
+  Packed() : value_(_mm256_setzero_ps()) {}
+  Packed(float value) : value_(_mm256_set1_ps(value)) {}
+  Packed(__m256 value) : value_(value) {}
+
+  // Memory
+  static Packed load(const float *data) { return _mm256_loadu_ps(data); }
+  void store(float *data) const { _mm256_storeu_ps(data, value_); }
+
+  // Arithmetic
+  friend Packed operator+(const Packed& a, const Packed& b) {
+    return _mm256_add_ps(a.value_, b.value_);
+  }
+  friend Packed operator-(const Packed& a, const Packed& b) {
+    return _mm256_sub_ps(a.value_, b.value_);
+  }
+  friend Packed operator*(const Packed& a, const Packed& b) {
+    return _mm256_mul_ps(a.value_, b.value_);
+  }
+  friend Packed operator/(const Packed& a, const Packed& b) {
+    return _mm256_div_ps(a.value_, b.value_);
+  }
+
+  // Comparison, which results in a mask for Select()
+  friend Packed operator<(const Packed& a, const Packed& b) {
+    return _mm256_cmp_ps(a.value_, b.value_, _CMP_LT_OQ);
+  }
+
+  // Functions
+  friend Packed Select(const Packed& mask, const Packed& a, const Packed& b) {
+    return _mm256_blendv_ps(b.value_, a.value_, mask.value_);
+  }
+  friend Packed Sqrt(const Packed& a) {
+    return _mm256_sqrt_ps(a.value_);
+  }
+
+ private:
+  __m256 value_;
+};
+
+#elif defined(TAKRAM_EASING_PACKED_SSE2)
+
+template <>
+class Packed<double> final {
+ public:
+  using Value = double;
+  static constexpr const std::size_t width = 2;
+
+ public:
+  Packed() : value_(_mm_setzero_pd()) {}
+  Packed(double value) : value_(_mm_set1_pd(value)) {}
+  Packed(__m128d value) : value_(value) {}
+
+  // Memory
+  static Packed load(const double *data) { return _mm_loadu_pd(data); }
+  void store(double *data) const { _mm_storeu_pd(data, value_); }
+
+  // Arithmetic
+  friend Packed operator+(const Packed& a, const Packed& b) {
+    return _mm_add_pd(a.value_, b.value_);
+  }
+  friend Packed operator-(const Packed& a, const Packed& b) {
+    return _mm_sub_pd(a.value_, b.value_);
+  }
+  friend Packed operator*(const Packed& a, const Packed& b) {
+    return _mm_mul_pd(a.value_, b.value_);
+  }
+  friend Packed operator/(const Packed& a, const Packed& b) {
+    return _mm_div_pd(a.value_, b.value_);
+  }
+
+  // Comparison, which results in a mask for Select()
+  friend Packed operator<(const Packed& a, const Packed& b) {
+    return _mm_cmplt_pd(a.value_, b.value_);
+  }
+
+  // Functions
+  friend Packed Select(const Packed& mask, const Packed& a, const Packed& b) {
+    return _mm_or_pd(_mm_and_pd(mask.value_, a.value_),
+                     _mm_andnot_pd(mask.value_, b.value_));
+  }
+  friend Packed Sqrt(const Packed& a) {
+    return _mm_sqrt_pd(a.value_);
+  }
+
+ private:
+  __m128d value_;
+};
+
+template <>
+class Packed<float> final {
+ public:
+  using Value = float;
+  static constexpr const std::size_t width = 4;
+
+ public:
+  Packed() : value_(_mm_setzero_ps()) {}
+  Packed(float value) : value_(_mm_set1_ps(value)) {}
+  Packed(__m128 value) : value_(value) {}
+
+  // Memory
+  static Packed load(const float *data) { return _mm_loadu_ps(data); }
+  void store(float *data) const { _mm_storeu_ps(data, value_); }
+
+  // Arithmetic
+  friend Packed operator+(const Packed& a, const Packed& b) {
+    return _mm_add_ps(a.value_, b.value_);
+  }
+  friend Packed operator-(const Packed& a, const Packed& b) {
+    return _mm_sub_ps(a.value_, b.value_);
+  }
+  friend Packed operator*(const Packed& a, const Packed& b) {
+    return _mm_mul_ps(a.value_, b.value_);
+  }
+  friend Packed operator/(const Packed& a, const Packed& b) {
+    return _mm_div_ps(a.value_, b.value_);
+  }
+
+  // Comparison, which results in a mask for Select()
+  friend Packed operator<(const Packed& a, const Packed& b) {
+    return _mm_cmplt_ps(a.value_, b.value_);
+  }
+
+  // Functions
+  friend Packed Select(const Packed& mask, const Packed& a, const Packed& b) {
+    return _mm_or_ps(_mm_and_ps(mask.value_, a.value_),
+                     _mm_andnot_ps(mask.value_, b.value_));
+  }
+  friend Packed Sqrt(const Packed& a) {
+    return _mm_sqrt_ps(a.value_);
+  }
+
+ private:
+  __m128 value_;
+};
+
+#endif  // TAKRAM_EASING_PACKED_SSE2
+
+// Whether the function can be evaluated against packed values of T wider than
+// a single value
+template <class Function, class T, class = void>
+struct IsPackable : std::false_type {};
+
+template <class Function, class T>
+struct IsPackable<Function, T, decltype(void(
+    std::declval<Function&>()(std::declval<const Packed<T>&>())))>
+    : std::integral_constant<bool, (Packed<T>::width > 1)> {};
+
+// Evaluates the given number of parameters, using the packed function for as
+// many parameters as possible when the Function is packable, and the scalar
+// function for the rest.
+template <class Function, class T, class Scalar, class Vector>
+void EvaluatePacked(const T *parameters,
+                    T *results,
+                    std::size_t count,
+                    Scalar scalar,
+                    Vector vector);
+
+#pragma mark -
+
+namespace detail {
+
+template <class T, class Vector>
+inline std::size_t EvaluatePacked(const T *parameters,
+                                  T *results,
+                                  std::size_t count,
+                                  Vector vector,
+                                  std::true_type) {
+  constexpr const auto width = Packed<T>::width;
+  std::size_t i = 0;
+  for (; i + width <= count; i += width) {
+    vector(Packed<T>::load(parameters + i)).store(results + i);
+  }
+  return i;
+}
+
+template <class T, class Vector>
+inline std::size_t EvaluatePacked(const T *,
+                                  T *,
+                                  std::size_t,
+                                  Vector,
+                                  std::false_type) {
+  return 0;
+}
+
+}  // namespace detail
+
+template <class Function, class T, class Scalar, class Vector>
+inline void EvaluatePacked(const T *parameters,
+                           T *results,
+                           std::size_t count,
+                           Scalar scalar,
+                           Vector vector) {
+  std::size_t i = detail::EvaluatePacked(
+      parameters, results, count, vector, IsPackable<Function, T>());
+  for (; i < count; ++i) {
+    results[i] = scalar(parameters[i]);
+  }
+}
+
+}  // namespace easing
+}  // namespace takram
+
+#endif  // TAKRAM_EASING_PACKED_H_
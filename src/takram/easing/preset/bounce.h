@@ -36,22 +36,19 @@ namespace preset {
 
 template <class T>
 struct Bounce {
-  T operator()(T parameter) {
+  constexpr T operator()(T parameter) const {
     const T v = 1.0 - parameter;
-    T c;
-    T d;
-    if (v < (1.0 / 2.750)) {
-      c = v;
-      d = 0;
-    } else if (v < (2.0 / 2.750)) {
-      c = v - 1.50 / 2.750;
-      d = 0.750;
-    } else if (v < (2.5 / 2.750)) {
-      c = v - 2.250 / 2.750;
-      d = 0.93750;
-    } else {
+    T c = v;
+    T d = 0.0;
+    if (v >= (2.5 / 2.750)) {
       c = v - 2.6250 / 2.750;
       d = 0.9843750;
+    } else if (v >= (2.0 / 2.750)) {
+      c = v - 2.250 / 2.750;
+      d = 0.93750;
+    } else if (v >= (1.0 / 2.750)) {
+      c = v - 1.50 / 2.750;
+      d = 0.750;
     }
     return 1.0 - (7.56250 * c * c + d);
   }
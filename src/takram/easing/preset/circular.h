@@ -31,6 +31,7 @@
 #include <cmath>
 
 #include "takram/easing/group.h"
+#include "takram/easing/packed.h"
 
 namespace takram {
 namespace easing {
@@ -38,9 +39,12 @@ namespace preset {
 
 template <class T>
 struct Circular {
-  T operator()(T parameter) {
+  T operator()(T parameter) const {
     return 1.0 - std::sqrt(1.0 - parameter * parameter);
   }
+  Packed<T> operator()(const Packed<T>& parameter) const {
+    return 1.0 - Sqrt(1.0 - parameter * parameter);
+  }
 };
 
 template <class T>
@@ -29,6 +29,7 @@
 #define TAKRAM_EASING_PRESET_CUBIC_H_
 
 #include "takram/easing/group.h"
+#include "takram/easing/packed.h"
 
 namespace takram {
 namespace easing {
@@ -36,7 +37,10 @@ namespace preset {
 
 template <class T>
 struct Cubic {
-  T operator()(T parameter) {
+  constexpr T operator()(T parameter) const {
+    return parameter * parameter * parameter;
+  }
+  Packed<T> operator()(const Packed<T>& parameter) const {
     return parameter * parameter * parameter;
   }
 };
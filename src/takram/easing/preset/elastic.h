@@ -39,7 +39,7 @@ namespace preset {
 
 template <class T>
 struct Elastic {
-  T operator()(T parameter) {
+  T operator()(T parameter) const {
     const T v = parameter - 1.0;
     const T p = 0.3;
     return -std::pow(2.0, 10.0 * v) *
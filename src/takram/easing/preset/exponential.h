@@ -38,7 +38,7 @@ namespace preset {
 
 template <class T>
 struct Exponential {
-  T operator()(T parameter) {
+  T operator()(T parameter) const {
     if (parameter == 0.0) {
       return 0.0;
     }
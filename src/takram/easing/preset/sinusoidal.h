@@ -39,7 +39,7 @@ namespace preset {
 
 template <class T>
 struct Sinusoidal {
-  T operator()(T parameter) {
+  T operator()(T parameter) const {
     return 1.0 - std::cos(parameter * math::half_pi<T>);
   }
 };
@@ -28,26 +28,41 @@
 #ifndef TAKRAM_EASING_SYMMETRIC_INFLECTOR_H_
 #define TAKRAM_EASING_SYMMETRIC_INFLECTOR_H_
 
-#include "takram/easing/inflector.h"
-#include "takram/easing/reverse_inflector.h"
+#include <cstddef>
+
+#include "takram/easing/packed.h"
 
 namespace takram {
 namespace easing {
 
 template <class T, template <class = T> class Function>
 struct SymmetricInflector {
-  T operator()(T parameter);
+  using Value = T;
+  constexpr T operator()(T parameter) const;
+  void operator()(const T *parameters, T *results, std::size_t count) const;
 };
 
 #pragma mark -
 
 template <class T, template <class> class Function>
-inline T SymmetricInflector<T, Function>::operator()(T parameter) {
-  if (parameter < 0.5) {
-    return Inflector<T, Function>()(2.0 * parameter) / 2.0;
-  } else {
-    return 0.5 + ReverseInflector<T, Function>()(2.0 * parameter - 1.0) / 2.0;
-  }
+constexpr T SymmetricInflector<T, Function>::operator()(T parameter) const {
+  return parameter < 0.5 ?
+      Function<T>()(2.0 * parameter) / 2.0 :
+      0.5 + (1.0 - Function<T>()(2.0 - 2.0 * parameter)) / 2.0;
+}
+
+template <class T, template <class> class Function>
+inline void SymmetricInflector<T, Function>::operator()(
+    const T *parameters,
+    T *results,
+    std::size_t count) const {
+  EvaluatePacked<Function<T>>(parameters, results, count, *this,
+      [](const auto& parameter) {
+        const auto in = Function<T>()(2.0 * parameter) / 2.0;
+        const auto out =
+            0.5 + (1.0 - Function<T>()(2.0 - 2.0 * parameter)) / 2.0;
+        return Select(parameter < 0.5, in, out);
+      });
 }
 
 }  // namespace easing
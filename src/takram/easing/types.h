@@ -28,13 +28,11 @@
 #ifndef TAKRAM_EASING_TYPES_H_
 #define TAKRAM_EASING_TYPES_H_
 
-#include <functional>
-
 namespace takram {
 namespace easing {
 
 template <class T>
-using Easing = std::function<T(T)>;
+class Easing;
 
 }  // namespace easing
 }  // namespace takram
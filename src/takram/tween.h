@@ -43,10 +43,15 @@ extern const unsigned char version_string[];
 #include "takram/tween/easing.h"
 #include "takram/tween/hash.h"
 #include "takram/tween/interval.h"
+#include "takram/tween/keyframe.h"
+#include "takram/tween/parallel_adaptor.h"
 #include "takram/tween/pointer_adaptor.h"
+#include "takram/tween/quaternion.h"
+#include "takram/tween/sequence_adaptor.h"
 #include "takram/tween/timeline.h"
 #include "takram/tween/timeline_host.h"
 #include "takram/tween/timer_adaptor.h"
+#include "takram/tween/track_adaptor.h"
 #include "takram/tween/transform.h"
 #include "takram/tween/types.h"
 #include "takram/tween/tween.h"
@@ -32,6 +32,7 @@
 #include <cstddef>
 #include <functional>
 #include <string>
+#include <typeinfo>
 
 #include "takram/tween/adaptor.h"
 #include "takram/tween/easing.h"
@@ -81,6 +82,9 @@ class AccessorAdaptor : public Adaptor<Interval_> {
   std::size_t object_hash() const override;
   std::size_t target_hash() const override;
 
+  // Batch update
+  typename Adaptor<Interval>::Batch batch() const override;
+
   // Parameters
   Class * object() const { return object_; }
   const Value& from() const { return from_; }
@@ -91,6 +95,8 @@ class AccessorAdaptor : public Adaptor<Interval_> {
   void update(Unit unit) override;
 
  private:
+  friend class Adaptor<Interval>;
+
   Class *object_;
   Getter getter_;
   Setter setter_;
@@ -136,7 +142,11 @@ inline void AccessorAdaptor<Interval, Value, Class, Getter, Setter>
     ::update(Unit unit) {
   assert(object_);
   if (unit < 0.0) {
-    from_ = (object_->*getter_)();
+    if (this->begun()) {
+      (object_->*setter_)(from_);
+    } else {
+      from_ = (object_->*getter_)();
+    }
   } else if (Adaptor<Interval>::duration().empty() || unit > 1.0) {
     (object_->*setter_)(transform(this->easing(), 1.0, from_, to_));
   } else {
@@ -166,6 +176,21 @@ inline std::size_t AccessorAdaptor<Interval, Value, Class, Getter, Setter>
   return target_hash_;
 }
 
+#pragma mark Batch update
+
+template <class Interval,
+          class Value,
+          class Class,
+          class Getter,
+          class Setter>
+inline typename Adaptor<Interval>::Batch
+    AccessorAdaptor<Interval, Value, Class, Getter, Setter>::batch() const {
+  if (typeid(*this) != typeid(AccessorAdaptor)) {
+    return nullptr;
+  }
+  return &Adaptor<Interval>::template update<AccessorAdaptor>;
+}
+
 }  // namespace tween
 }  // namespace takram
 
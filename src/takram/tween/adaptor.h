@@ -28,7 +28,10 @@
 #ifndef TAKRAM_TWEEN_ADAPTOR_H_
 #define TAKRAM_TWEEN_ADAPTOR_H_
 
+#include <cmath>
 #include <cstddef>
+#include <limits>
+#include <memory>
 
 #include "takram/tween/easing.h"
 #include "takram/tween/types.h"
@@ -40,6 +43,13 @@ template <class Interval_>
 class Adaptor {
  public:
   using Interval = Interval_;
+  using Batch = void (*)(const std::shared_ptr<Adaptor> *adaptors,
+                         std::size_t count,
+                         const Interval& now);
+
+  // Repeat count of adaptors that loop until they are stopped
+  static constexpr const std::size_t infinite =
+      std::numeric_limits<std::size_t>::max();
 
  public:
   virtual ~Adaptor() = 0;
@@ -53,6 +63,10 @@ class Adaptor {
   void stop();
   void update(const Interval& now, bool callback = true);
 
+  // Updates as update() does, but holds the end values past the end instead
+  // of finishing, so that the adaptor can be sought back before its end
+  void seek(const Interval& now);
+
   // Attributes
   bool running() const { return running_; }
   bool finished() const { return finished_; }
@@ -61,6 +75,27 @@ class Adaptor {
   virtual std::size_t object_hash() const = 0;
   virtual std::size_t target_hash() const = 0;
 
+  // Batch update. Batch functions call update() of the class they are made
+  // for without virtual dispatch, so adaptors return them only when that class
+  // is their dynamic type, leaving subclasses that override update() to the
+  // virtual path.
+  virtual Batch batch() const { return nullptr; }
+
+  // Scheduling. Deferrable adaptors have no effect until they finish, so that
+  // timelines may leave them alone until their deadlines.
+  virtual bool deferrable() const { return false; }
+  Interval deadline() const;
+  Interval wakeup() const { return started_ + delay_; }
+
+  // Length of all the cycles after the delay, which is the largest interval
+  // for adaptors that repeat infinitely
+  Interval span() const;
+  void wake();
+
+  // Concurrent adaptors only change their own targets, so that timelines may
+  // update them in parallel with the adaptors of other objects.
+  virtual bool concurrent() const { return true; }
+
   // Parameters
   const Easing& easing() const;
   void set_easing(const Easing& value);
@@ -71,6 +106,15 @@ class Adaptor {
   const Callback& callback() const;
   void set_callback(const Callback& value);
 
+  // Repetition. The adaptor runs its duration once plus the repeat count, or
+  // until stopped when the count is infinite, folding the elapsed time into
+  // each cycle rather than restarting. Yoyo adaptors run every other cycle
+  // backwards.
+  std::size_t repeat() const { return repeat_; }
+  void set_repeat(std::size_t value) { repeat_ = value; }
+  bool yoyo() const { return yoyo_; }
+  void set_yoyo(bool value) { yoyo_ = value; }
+
  protected:
   Adaptor(const Easing& easing,
           const Interval& duration,
@@ -80,16 +124,47 @@ class Adaptor {
   // Move semantics
   Adaptor(Adaptor&&) = default;
 
-  // Updates against the local unit time
+  // Updates against the local unit time. Negative units are given while the
+  // adaptor is in its delay, on which derived classes take their starting
+  // values, or restore the ones taken once the adaptor has begun, that is,
+  // has been updated past its delay.
   virtual void update(Unit unit) = 0;
+  bool begun() const { return begun_; }
+
+  // Updates adaptors of the same derived class in a single loop, calling
+  // Derived::update(Unit) without virtual dispatch
+  template <class Derived>
+  static void update(const std::shared_ptr<Adaptor> *adaptors,
+                     std::size_t count,
+                     const Interval& now);
+
+  // Updates a child adaptor against the time elapsed since its parent
+  // reached it, given in the count of intervals, for adaptors that drive
+  // others. The child takes its starting values once its delay has passed,
+  // and its callback is never called, because children are updated inside
+  // the timeline where callbacks must not run. The elapsed time may go back,
+  // as when the parent repeats or runs backwards, in which case the child
+  // runs again from the same starting values, and restores them when moved
+  // back into its delay.
+  static void update(Adaptor& child, Unit elapsed);
+
+ private:
+  // Folds the elapsed time, given in the count of intervals, into the local
+  // unit time of the current cycle, and returns false when the adaptor has
+  // reached its end
+  bool fold(Unit elapsed, Unit *unit) const;
+  void finish();
 
  private:
   Easing easing_;
   Interval duration_;
   Interval delay_;
   Callback callback_;
+  std::size_t repeat_;
+  bool yoyo_;
   bool running_;
   bool finished_;
+  bool begun_;
   Interval started_;
 };
 
@@ -105,12 +180,18 @@ inline Adaptor<Interval>::Adaptor(
       duration_(duration),
       delay_(delay),
       callback_(callback),
+      repeat_(),
+      yoyo_(),
       running_(false),
-      finished_(false) {}
+      finished_(false),
+      begun_(false) {}
 
 template <class Interval>
 inline Adaptor<Interval>::~Adaptor() {}
 
+template <class Interval>
+constexpr const std::size_t Adaptor<Interval>::infinite;
+
 #pragma mark Controlling the adaptor
 
 template <class Interval>
@@ -118,7 +199,9 @@ inline void Adaptor<Interval>::start(const Interval& now) {
   if (!running_) {
     running_ = true;
     if (!finished_) {
+      // Take the starting values again when restarted
       started_ = now;
+      begun_ = false;
     }
   }
 }
@@ -133,14 +216,15 @@ inline void Adaptor<Interval>::stop() {
 template <class Interval>
 inline void Adaptor<Interval>::update(const Interval& now, bool callback) {
   if (running_) {
-    const auto elapsed = now - started_ - delay_;
-    if (elapsed < duration_) {
-      update(elapsed / duration_);
+    Unit unit;
+    if (fold((now - started_ - delay_).count(), &unit)) {
+      update(unit);
+      if (unit >= 0.0) {
+        begun_ = true;
+      }
     } else {
-      update(1.0);
-      running_ = false;
-      finished_ = true;
-      started_ = Interval();
+      update(unit);
+      finish();
       if (callback && callback_) {
         callback_();
       }
@@ -148,6 +232,128 @@ inline void Adaptor<Interval>::update(const Interval& now, bool callback) {
   }
 }
 
+template <class Interval>
+inline void Adaptor<Interval>::seek(const Interval& now) {
+  if (running_) {
+    Unit unit;
+    fold((now - started_ - delay_).count(), &unit);
+    update(unit);
+    if (unit >= 0.0) {
+      begun_ = true;
+    }
+  }
+}
+
+template <class Interval>
+inline void Adaptor<Interval>::wake() {
+  // Let the derived class take its starting values as it would have done on
+  // every update during the delay
+  if (running_) {
+    update(Unit(-1.0));
+  }
+}
+
+template <class Interval>
+template <class Derived>
+inline void Adaptor<Interval>::update(const std::shared_ptr<Adaptor> *adaptors,
+                                      std::size_t count,
+                                      const Interval& now) {
+  for (std::size_t i = 0; i < count; ++i) {
+    Adaptor& adaptor = *adaptors[i];
+    if (adaptor.running_) {
+      auto& derived = static_cast<Derived&>(adaptor);
+      Unit unit;
+      const auto elapsed = now - adaptor.started_ - adaptor.delay_;
+      if (adaptor.fold(elapsed.count(), &unit)) {
+        derived.Derived::update(unit);
+        if (unit >= 0.0) {
+          adaptor.begun_ = true;
+        }
+      } else {
+        derived.Derived::update(unit);
+        adaptor.finish();
+      }
+    }
+  }
+}
+
+template <class Interval>
+inline void Adaptor<Interval>::update(Adaptor& child, Unit elapsed) {
+  const auto local = elapsed - static_cast<Unit>(child.delay_.count());
+  if (local < 0.0) {
+    if (child.begun_) {
+      child.update(Unit(-1.0));
+    }
+    child.running_ = false;
+    child.finished_ = false;
+    return;
+  }
+  Unit unit;
+  const auto running = child.fold(local, &unit);
+  if (!running && child.finished_) {
+    return;  // Leave the end values to the children that follow
+  }
+  if (!child.begun_) {
+    child.update(Unit(-1.0));
+    child.begun_ = true;
+  }
+  child.update(unit);
+  child.running_ = running;
+  child.finished_ = !running;
+}
+
+template <class Interval>
+inline bool Adaptor<Interval>::fold(Unit elapsed, Unit *unit) const {
+  const auto duration = static_cast<Unit>(duration_.count());
+  if (elapsed < duration) {
+    *unit = elapsed / duration;
+    return true;
+  } else if (!repeat_ || duration_.empty()) {
+    *unit = 1.0;
+    return false;
+  }
+  const auto progress = elapsed / duration;
+  if (repeat_ != infinite && progress >= static_cast<Unit>(repeat_) + 1.0) {
+    *unit = yoyo_ && repeat_ % 2 ? 0.0 : 1.0;
+    return false;
+  }
+  const auto cycle = std::floor(progress);
+  *unit = progress - cycle;
+  if (yoyo_ && std::fmod(cycle, Unit(2.0))) {
+    *unit = 1.0 - *unit;
+  }
+  return true;
+}
+
+template <class Interval>
+inline void Adaptor<Interval>::finish() {
+  running_ = false;
+  finished_ = true;
+  started_ = Interval();
+}
+
+#pragma mark Scheduling
+
+template <class Interval>
+inline Interval Adaptor<Interval>::deadline() const {
+  if (repeat_ == infinite) {
+    return span();
+  }
+  return started_ + delay_ + span();
+}
+
+template <class Interval>
+inline Interval Adaptor<Interval>::span() const {
+  using Value = typename Interval::Value;
+  if (!repeat_) {
+    return duration_;
+  } else if (repeat_ == infinite) {
+    return Interval(std::numeric_limits<Value>::max());
+  }
+  return Interval(static_cast<Value>(
+      duration_.count() * static_cast<Value>(repeat_ + 1)));
+}
+
 #pragma mark Parameters
 
 template <class Interval>
@@ -28,13 +28,50 @@
 #ifndef TAKRAM_TWEEN_CLOCK_H_
 #define TAKRAM_TWEEN_CLOCK_H_
 
+#include <cassert>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
 
 #include "takram/tween/interval.h"
+#include "takram/tween/types.h"
 
 namespace takram {
 namespace tween {
 
+// Time sources return monotonic nanoseconds from an arbitrary origin. The
+// steady source reads std::chrono::steady_clock, and the coarse source reads
+// a cheaper clock at the resolution of the scheduler tick where the platform
+// has one, falling back to the steady source otherwise.
+using TimeSource = std::int64_t (*)();
+
+std::int64_t SteadyTimeSource();
+std::int64_t CoarseTimeSource();
+
+// Clock keeps the playback time of a timeline. Advancing the clock reads its
+// source, the wall clock or a frame counter, and adds the time elapsed since
+// the last read scaled by the rate, unless the clock is paused. Fractions of
+// scaled frames are carried over to the next advance.
+//
+// Clocks of time read their source in integer nanoseconds and count from
+// their construction, so that the time stays exact over long uptimes. The
+// source can be replaced by a user function at any time without a jump in the
+// time. Clocks of frames count advances and ignore the source.
+//
+// A clock can also be advanced to a time sampled outside, for example by
+// another clock shared among many timelines, which sets the time as it is
+// unless the clock is paused. The rate and the fixed step apply only to the
+// time read from the source, and the next read only resynchronizes the
+// source, so that the time does not jump back or twice.
+//
+// With a fixed step, advancing accumulates the scaled time and moves the time
+// by whole steps from where the step was set, so that the times are exact
+// multiples of the step however advances are timed. The alpha is the fraction
+// of a step left in the accumulator, for interpolating between the last two
+// steps. Steps beyond the maximum count per advance, if any, are dropped to
+// recover from hitches.
 template <class Interval_>
 class Clock final {
  public:
@@ -53,23 +90,94 @@ class Clock final {
 
   // Controlling clock
   Interval advance();
+  Interval advance(const Interval& now);
   Interval now() const { return Interval(now_); }
 
+  // Playback
+  void pause() { paused_ = true; }
+  void resume() { paused_ = false; }
+  bool paused() const { return paused_; }
+  void seek(const Interval& time);
+  Unit rate() const { return rate_; }
+  void set_rate(Unit value) { rate_ = value; }
+
+  // Fixed step
+  Interval fixed_step() const { return Interval(step_); }
+  void set_fixed_step(const Interval& value);
+  std::size_t max_steps() const { return max_steps_; }
+  void set_max_steps(std::size_t value) { max_steps_ = value; }
+  Unit alpha() const;
+
+  // Source
+  TimeSource source() const { return time_source_; }
+  void set_source(TimeSource value);
+
+ private:
+  using Value = typename Interval::Value;
+  using Ticks = std::int64_t;
+
+  // Reads the source of the clock in ticks since the birth
+  Ticks read() const;
+
+  // Converts ticks to the value of the interval
+  static Value convert(Ticks ticks);
+
  private:
-  typename Interval::Value now_;
-  typename Interval::Value birth_;
+  TimeSource time_source_;
+  Ticks birth_;
+  Ticks source_;
+  Ticks ticks_;
+  Value now_;
+  Unit accumulator_;
+  Unit rate_;
+  bool paused_;
+  Value step_;
+  Value origin_;
+  std::int64_t steps_;
+  std::size_t max_steps_;
+  bool external_;
 };
 
 #pragma mark -
 
 template <class Interval>
-inline Clock<Interval>::Clock() : now_(), birth_(advance().count()) {}
+inline Clock<Interval>::Clock()
+    : time_source_(&SteadyTimeSource),
+      birth_(),
+      source_(),
+      ticks_(),
+      now_(),
+      accumulator_(),
+      rate_(1.0),
+      paused_(false),
+      step_(),
+      origin_(),
+      steps_(),
+      max_steps_(),
+      external_() {
+  birth_ = time_source_();
+  source_ = read();
+  now_ = convert(source_);
+  origin_ = now_;
+}
 
 #pragma mark Comparison
 
 template <class Interval>
 inline bool Clock<Interval>::operator==(const Clock& other) const {
-  return (now_ == other.now_ && birth_ == other.birth_);
+  return (time_source_ == other.time_source_ &&
+          birth_ == other.birth_ &&
+          source_ == other.source_ &&
+          ticks_ == other.ticks_ &&
+          now_ == other.now_ &&
+          accumulator_ == other.accumulator_ &&
+          rate_ == other.rate_ &&
+          paused_ == other.paused_ &&
+          step_ == other.step_ &&
+          origin_ == other.origin_ &&
+          steps_ == other.steps_ &&
+          max_steps_ == other.max_steps_ &&
+          external_ == other.external_);
 }
 
 template <class Interval>
@@ -79,18 +187,141 @@ inline bool Clock<Interval>::operator!=(const Clock& other) const {
 
 #pragma mark Controlling clock
 
+template <class Interval>
+inline Interval Clock<Interval>::advance() {
+  const auto source = read();
+  const auto elapsed = external_ ? Ticks() : source - source_;
+  source_ = source;
+  external_ = false;
+  if (paused_) {
+    return Interval(now_);
+  } else if (step_) {
+    accumulator_ += static_cast<Unit>(convert(elapsed)) * rate_;
+    auto steps = static_cast<std::int64_t>(std::floor(accumulator_ / step_));
+    const auto limit = static_cast<std::int64_t>(max_steps_);
+    if (max_steps_ && (steps > limit || steps < -limit)) {
+      const auto dropped = steps > 0 ? steps - limit : steps + limit;
+      accumulator_ -= static_cast<Unit>(dropped) * step_;
+      steps -= dropped;
+    }
+    accumulator_ -= static_cast<Unit>(steps) * step_;
+    steps_ += steps;
+    now_ = origin_ + static_cast<Value>(steps_) * step_;
+  } else if (rate_ == 1.0 && !accumulator_) {
+    // Count the ticks from the origin instead of summing up the conversions
+    ticks_ += elapsed;
+    now_ = origin_ + convert(ticks_);
+  } else {
+    const auto scaled =
+        static_cast<Unit>(convert(elapsed)) * rate_ + accumulator_;
+    const auto step = static_cast<Value>(scaled);
+    accumulator_ = scaled - static_cast<Unit>(step);
+    now_ += step;
+    origin_ = now_;
+    ticks_ = 0;
+  }
+  return Interval(now_);
+}
+
+template <class Interval>
+inline Interval Clock<Interval>::advance(const Interval& now) {
+  if (paused_) {
+    return Interval(now_);
+  }
+  now_ = now.count();
+  origin_ = now_;
+  ticks_ = 0;
+  steps_ = 0;
+  accumulator_ = Unit();
+  external_ = true;
+  return Interval(now_);
+}
+
+template <>
+inline std::int64_t Clock<Time>::read() const {
+  return time_source_() - birth_;
+}
+
+template <>
+inline std::int64_t Clock<Frame>::read() const {
+  return source_ + 1;
+}
+
+template <>
+inline TimeValue Clock<Time>::convert(std::int64_t ticks) {
+  return static_cast<TimeValue>(ticks) / TimeValue(1e9);
+}
+
 template <>
-inline Time Clock<Time>::advance() {
-  using Clock = std::chrono::high_resolution_clock;
-  using Duration = std::chrono::microseconds;
-  now_ = static_cast<TimeValue>(std::chrono::duration_cast<Duration>(
-      Clock::now().time_since_epoch()).count()) / Duration::period::den;
-  return Time(now_);
+inline FrameValue Clock<Frame>::convert(std::int64_t ticks) {
+  return static_cast<FrameValue>(ticks);
+}
+
+#pragma mark Playback
+
+template <class Interval>
+inline void Clock<Interval>::seek(const Interval& time) {
+  now_ = time.count();
+  origin_ = now_;
+  ticks_ = 0;
+  steps_ = 0;
+  accumulator_ = Unit();
+}
+
+#pragma mark Fixed step
+
+template <class Interval>
+inline void Clock<Interval>::set_fixed_step(const Interval& value) {
+  step_ = value.count();
+  origin_ = now_;
+  ticks_ = 0;
+  steps_ = 0;
+  accumulator_ = Unit();
+}
+
+template <class Interval>
+inline Unit Clock<Interval>::alpha() const {
+  if (!step_) {
+    return Unit();
+  }
+  return accumulator_ / step_;
+}
+
+#pragma mark Source
+
+template <class Interval>
+inline void Clock<Interval>::set_source(TimeSource value) {
+  assert(value);
+  // Rebase the birth so that the ticks read continue from the last read
+  birth_ = value() - source_;
+  time_source_ = value;
 }
 
 template <>
-inline Frame Clock<Frame>::advance() {
-  return Frame(++now_);
+inline void Clock<Frame>::set_source(TimeSource value) {
+  assert(value);
+  time_source_ = value;
+}
+
+#pragma mark Time sources
+
+inline std::int64_t SteadyTimeSource() {
+  using Duration = std::chrono::nanoseconds;
+  return std::chrono::duration_cast<Duration>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline std::int64_t CoarseTimeSource() {
+#if defined(CLOCK_MONOTONIC_COARSE)
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC_COARSE, &time);
+  return static_cast<std::int64_t>(time.tv_sec) * 1000000000 + time.tv_nsec;
+#elif defined(__APPLE__) && defined(CLOCK_MONOTONIC_RAW_APPROX)
+  return static_cast<std::int64_t>(
+      clock_gettime_nsec_np(CLOCK_MONOTONIC_RAW_APPROX));
+#else
+  return SteadyTimeSource();
+#endif
 }
 
 }  // namespace tween
@@ -28,6 +28,10 @@
 #ifndef TAKRAM_TWEEN_EASING_H_
 #define TAKRAM_TWEEN_EASING_H_
 
+#include "takram/easing/bezier.h"
+#include "takram/easing/composition.h"
+#include "takram/easing/easing.h"
+#include "takram/easing/lookup.h"
 #include "takram/easing/preset.h"
 #include "takram/easing/types.h"
 #include "takram/tween/types.h"
@@ -37,12 +41,14 @@ namespace tween {
 
 using Easing = easing::Easing<Unit>;
 using BackEasing = easing::BackEasing<Unit>;
+using BezierEasing = easing::Bezier<Unit>;
 using BounceEasing = easing::BounceEasing<Unit>;
 using CircularEasing = easing::CircularEasing<Unit>;
 using CubicEasing = easing::CubicEasing<Unit>;
 using ElasticEasing = easing::ElasticEasing<Unit>;
 using ExponentialEasing = easing::ExponentialEasing<Unit>;
 using LinearEasing = easing::LinearEasing<Unit>;
+using LookupEasing = easing::Lookup<Unit>;
 using QuadraticEasing = easing::QuadraticEasing<Unit>;
 using QuarticEasing = easing::QuarticEasing<Unit>;
 using QuinticEasing = easing::QuinticEasing<Unit>;
@@ -1,5 +1,5 @@
 //
-//  takram/tween/transform.cc
+//  takram/tween/keyframe.h
 //
 //  The MIT License
 //
@@ -24,7 +24,9 @@
 //  DEALINGS IN THE SOFTWARE.
 //
 
-#include "takram/tween/transform.h"
+#pragma once
+#ifndef TAKRAM_TWEEN_KEYFRAME_H_
+#define TAKRAM_TWEEN_KEYFRAME_H_
 
 #include "takram/tween/easing.h"
 #include "takram/tween/types.h"
@@ -32,32 +34,21 @@
 namespace takram {
 namespace tween {
 
-template <class T>
-T transform(const Easing& easing, Unit unit, const T& from, const T& to) {
-  return from + (to - from) * easing(unit);
-}
+// Keyframe places a value at a position in the unit time of a track, and
+// eases the segment that follows it towards the next keyframe.
+template <class Value>
+struct Keyframe {
+  Unit position;
+  Value value;
+  Easing easing = LinearEasing::In;
+};
 
-#define TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(T) \
-    template T transform(const Easing&, Unit, const T&, const T&);
-
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(bool)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(char)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(signed char)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(unsigned char)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(char16_t)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(char32_t)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(wchar_t)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(short)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(unsigned short)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(int)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(unsigned int)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(long)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(unsigned long)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(long long)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(unsigned long long)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(float)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(double)
-TAKRAM_TWEEN_TRANSFORM_SPECIALIZE(long double)
+// Interpolation between the values of keyframes. CUBIC passes through the
+// values along a Catmull-Rom spline, the cubic Hermite spline whose tangents
+// are taken from the neighbouring keyframes.
+enum class Interpolation { LINEAR, CUBIC };
 
 }  // namespace tween
 }  // namespace takram
+
+#endif  // TAKRAM_TWEEN_KEYFRAME_H_
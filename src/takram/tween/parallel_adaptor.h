@@ -0,0 +1,177 @@
+//
+//  takram/tween/parallel_adaptor.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_TWEEN_PARALLEL_ADAPTOR_H_
+#define TAKRAM_TWEEN_PARALLEL_ADAPTOR_H_
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+#include "takram/tween/adaptor.h"
+#include "takram/tween/easing.h"
+#include "takram/tween/hash.h"
+#include "takram/tween/types.h"
+
+namespace takram {
+namespace tween {
+
+// ParallelAdaptor runs its children together from a single entry of the
+// timeline. Its duration is the longest of the delays plus spans of the
+// children when it is constructed, and its easing, which should not go back
+// and forth, eases the progress of all the children at once. Repeating the
+// group replays the children from the starting values they took in the first
+// cycle, and yoyo groups run them backwards. Children must not be started on
+// their own, nor repeat infinitely.
+template <class Interval_>
+class ParallelAdaptor : public Adaptor<Interval_> {
+ public:
+  using Interval = Interval_;
+  using Children = std::vector<std::shared_ptr<Adaptor<Interval>>>;
+
+ public:
+  explicit ParallelAdaptor(const Children& children,
+                           const Easing& easing = LinearEasing::In,
+                           const Interval& delay = Interval(),
+                           const Callback& callback = nullptr);
+
+  // Disallow copy semantics
+  ParallelAdaptor(const ParallelAdaptor&) = delete;
+  ParallelAdaptor& operator=(const ParallelAdaptor&) = delete;
+
+  // Move semantics
+  ParallelAdaptor(ParallelAdaptor&&) = default;
+
+  // Controlling the adaptor
+  using Adaptor<Interval>::update;
+
+  // Hash
+  std::size_t object_hash() const override;
+  std::size_t target_hash() const override;
+
+  // Batch update
+  typename Adaptor<Interval>::Batch batch() const override;
+
+  // Scheduling. Children may share their targets with other adaptors.
+  bool concurrent() const override { return false; }
+
+  // Parameters
+  const Children& children() const { return children_; }
+
+ protected:
+  // Updates against the local unit time
+  void update(Unit unit) override;
+
+ private:
+  friend class Adaptor<Interval>;
+
+  static Interval longest(const Children& children);
+
+  // Data members
+  Children children_;
+};
+
+#pragma mark -
+
+template <class Interval>
+inline ParallelAdaptor<Interval>::ParallelAdaptor(
+    const Children& children,
+    const Easing& easing,
+    const Interval& delay,
+    const Callback& callback)
+    : Adaptor<Interval>(easing, longest(children), delay, callback),
+      children_(children) {}
+
+template <class Interval>
+inline Interval ParallelAdaptor<Interval>::longest(const Children& children) {
+  Interval result;
+  for (const auto& child : children) {
+    assert(child);
+    assert(child->repeat() != Adaptor<Interval>::infinite);
+    const auto end = child->delay() + child->span();
+    if (result < end) {
+      result = end;
+    }
+  }
+  return result;
+}
+
+#pragma mark Updates against the local unit time
+
+template <class Interval>
+inline void ParallelAdaptor<Interval>::update(Unit unit) {
+  auto elapsed = -std::numeric_limits<Unit>::infinity();
+  if (unit < 0.0) {
+    // Rewind the children only once they have been reached
+    if (!this->begun()) {
+      return;
+    }
+  } else if (!this->duration().empty() && unit < 1.0) {
+    elapsed = this->easing()(unit) *
+        static_cast<Unit>(this->duration().count());
+  } else {
+    // Finish every child at the end regardless of rounding
+    elapsed = std::numeric_limits<Unit>::infinity();
+  }
+  for (const auto& child : children_) {
+    Adaptor<Interval>::update(*child, elapsed);
+  }
+}
+
+#pragma mark Hash
+
+// Parallel groups may drive several targets, so they are identified by the
+// address of the adaptor itself as timers are.
+
+template <class Interval>
+inline std::size_t ParallelAdaptor<Interval>::object_hash() const {
+  return Hash(this);
+}
+
+template <class Interval>
+inline std::size_t ParallelAdaptor<Interval>::target_hash() const {
+  return Hash(this);
+}
+
+#pragma mark Batch update
+
+template <class Interval>
+inline typename Adaptor<Interval>::Batch
+    ParallelAdaptor<Interval>::batch() const {
+  if (typeid(*this) != typeid(ParallelAdaptor)) {
+    return nullptr;
+  }
+  return &Adaptor<Interval>::template update<ParallelAdaptor>;
+}
+
+}  // namespace tween
+}  // namespace takram
+
+#endif  // TAKRAM_TWEEN_PARALLEL_ADAPTOR_H_
@@ -30,6 +30,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <typeinfo>
 
 #include "takram/tween/adaptor.h"
 #include "takram/tween/easing.h"
@@ -69,6 +70,9 @@ class PointerAdaptor : public Adaptor<Interval_> {
   std::size_t object_hash() const override;
   std::size_t target_hash() const override;
 
+  // Batch update
+  typename Adaptor<Interval>::Batch batch() const override;
+
   // Parameters
   Value * target() const { return target_; }
   const Value& from() const { return from_; }
@@ -79,6 +83,8 @@ class PointerAdaptor : public Adaptor<Interval_> {
   void update(Unit unit) override;
 
  private:
+  friend class Adaptor<Interval>;
+
   // Data members
   Value *target_;
   Value from_;
@@ -107,7 +113,11 @@ template <class Interval, class Value>
 inline void PointerAdaptor<Interval, Value>::update(Unit unit) {
   assert(target_);
   if (unit < 0.0) {
-    from_ = *target_;
+    if (this->begun()) {
+      *target_ = from_;
+    } else {
+      from_ = *target_;
+    }
   } else if (this->duration().empty() || unit > 1.0) {
     *target_ = transform(this->easing(), 1.0, from_, to_);
   } else {
@@ -127,6 +137,17 @@ inline std::size_t PointerAdaptor<Interval, Value>::target_hash() const {
   return Hash(target_);
 }
 
+#pragma mark Batch update
+
+template <class Interval, class Value>
+inline typename Adaptor<Interval>::Batch
+    PointerAdaptor<Interval, Value>::batch() const {
+  if (typeid(*this) != typeid(PointerAdaptor)) {
+    return nullptr;
+  }
+  return &Adaptor<Interval>::template update<PointerAdaptor>;
+}
+
 }  // namespace tween
 }  // namespace takram
 
@@ -0,0 +1,89 @@
+//
+//  takram/tween/pool.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "takram/tween/pool.h"
+
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace takram {
+namespace tween {
+
+constexpr const std::size_t Pool::alignment;
+constexpr const std::size_t Pool::max_size;
+constexpr const std::size_t Pool::blocks_per_chunk;
+
+Pool::~Pool() {
+  for (auto chunk : chunks_) {
+    ::operator delete(chunk);
+  }
+}
+
+#pragma mark Allocation
+
+void * Pool::allocate(std::size_t size) {
+  if (!size || size > max_size) {
+    return ::operator new(size);
+  }
+  const auto index = (size - 1) / alignment;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& list = lists_[index];
+  if (!list) {
+    // Thread a new chunk of blocks into the free list
+    const auto block_size = (index + 1) * alignment;
+    const auto chunk = static_cast<unsigned char *>(
+        ::operator new(block_size * blocks_per_chunk));
+    chunks_.emplace_back(chunk);
+    for (std::size_t i = 0; i < blocks_per_chunk; ++i) {
+      const auto block = reinterpret_cast<Block *>(chunk + i * block_size);
+      block->next = list;
+      list = block;
+    }
+  }
+  const auto block = list;
+  list = block->next;
+  return block;
+}
+
+void Pool::deallocate(void *pointer, std::size_t size) {
+  if (!pointer) {
+    return;
+  }
+  if (!size || size > max_size) {
+    ::operator delete(pointer);
+    return;
+  }
+  const auto index = (size - 1) / alignment;
+  const auto block = static_cast<Block *>(pointer);
+  std::lock_guard<std::mutex> lock(mutex_);
+  block->next = lists_[index];
+  lists_[index] = block;
+}
+
+}  // namespace tween
+}  // namespace takram
@@ -0,0 +1,156 @@
+//
+//  takram/tween/pool.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_TWEEN_POOL_H_
+#define TAKRAM_TWEEN_POOL_H_
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace takram {
+namespace tween {
+
+// Pool recycles small blocks of memory in free lists segregated by size, so
+// that objects that are frequently created and destroyed, such as adaptors and
+// timeline index nodes, do not hit the global heap after warming up. Larger
+// blocks are forwarded to the global operator new.
+class Pool final {
+ public:
+  static constexpr const std::size_t alignment = alignof(std::max_align_t);
+  static constexpr const std::size_t max_size = 32 * alignment;
+
+ public:
+  Pool() : lists_() {}
+  ~Pool();
+
+  // Disallow copy semantics
+  Pool(const Pool&) = delete;
+  Pool& operator=(const Pool&) = delete;
+
+  // Allocation
+  void * allocate(std::size_t size);
+  void deallocate(void *pointer, std::size_t size);
+
+ private:
+  struct Block {
+    Block *next;
+  };
+
+  static constexpr const std::size_t blocks_per_chunk = 64;
+
+ private:
+  std::mutex mutex_;
+  Block *lists_[max_size / alignment];
+  std::vector<void *> chunks_;
+};
+
+template <class T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+
+  template <class U>
+  struct rebind {
+    using other = PoolAllocator<U>;
+  };
+
+ public:
+  explicit PoolAllocator(std::shared_ptr<Pool> pool);
+  template <class U>
+  PoolAllocator(const PoolAllocator<U>& other);
+
+  // Copy semantics
+  PoolAllocator(const PoolAllocator&) = default;
+  PoolAllocator& operator=(const PoolAllocator&) = default;
+
+  // Comparison
+  template <class U>
+  bool operator==(const PoolAllocator<U>& other) const;
+  template <class U>
+  bool operator!=(const PoolAllocator<U>& other) const;
+
+  // Allocation
+  T * allocate(std::size_t count);
+  void deallocate(T *pointer, std::size_t count);
+
+  // Attributes
+  const std::shared_ptr<Pool>& pool() const { return pool_; }
+
+ private:
+  std::shared_ptr<Pool> pool_;
+};
+
+#pragma mark -
+
+template <class T>
+inline PoolAllocator<T>::PoolAllocator(std::shared_ptr<Pool> pool)
+    : pool_(std::move(pool)) {
+  assert(pool_);
+}
+
+template <class T>
+template <class U>
+inline PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& other)
+    : pool_(other.pool()) {}
+
+#pragma mark Comparison
+
+template <class T>
+template <class U>
+inline bool PoolAllocator<T>::operator==(
+    const PoolAllocator<U>& other) const {
+  return pool_ == other.pool();
+}
+
+template <class T>
+template <class U>
+inline bool PoolAllocator<T>::operator!=(
+    const PoolAllocator<U>& other) const {
+  return !operator==(other);
+}
+
+#pragma mark Allocation
+
+template <class T>
+inline T * PoolAllocator<T>::allocate(std::size_t count) {
+  static_assert(alignof(T) <= Pool::alignment,
+                "Over-aligned types cannot be allocated from Pool");
+  return static_cast<T *>(pool_->allocate(count * sizeof(T)));
+}
+
+template <class T>
+inline void PoolAllocator<T>::deallocate(T *pointer, std::size_t count) {
+  pool_->deallocate(pointer, count * sizeof(T));
+}
+
+}  // namespace tween
+}  // namespace takram
+
+#endif  // TAKRAM_TWEEN_POOL_H_
@@ -0,0 +1,114 @@
+//
+//  takram/tween/quaternion.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_TWEEN_QUATERNION_H_
+#define TAKRAM_TWEEN_QUATERNION_H_
+
+#include <cmath>
+#include <limits>
+
+#include "takram/tween/transform.h"
+#include "takram/tween/types.h"
+
+namespace takram {
+namespace tween {
+
+// Quaternion is a rotation value whose tweens follow the shortest arc between
+// rotations by spherical linear interpolation, instead of being interpolated
+// componentwise. Other quaternion types can reuse slerp() by specializing
+// Transform for themselves.
+template <class T>
+struct Quaternion {
+  T x;
+  T y;
+  T z;
+  T w;
+};
+
+template <class T>
+Quaternion<T> slerp(Unit unit,
+                    const Quaternion<T>& from,
+                    const Quaternion<T>& to);
+
+template <class T>
+struct Transform<Quaternion<T>> {
+  Quaternion<T> operator()(Unit unit,
+                           const Quaternion<T>& from,
+                           const Quaternion<T>& to) const {
+    return slerp(unit, from, to);
+  }
+};
+
+#pragma mark -
+
+template <class T>
+inline Quaternion<T> slerp(Unit unit,
+                           const Quaternion<T>& from,
+                           const Quaternion<T>& to) {
+  const auto t = static_cast<T>(unit);
+  auto cosine = from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w;
+
+  // Take the shortest arc by flipping the destination
+  T sign = 1;
+  if (cosine < 0) {
+    cosine = -cosine;
+    sign = -1;
+  }
+  T a;
+  T b;
+  if (cosine < 1 - std::sqrt(std::numeric_limits<T>::epsilon())) {
+    const auto angle = std::acos(cosine);
+    const auto sine = std::sin(angle);
+    a = std::sin((1 - t) * angle) / sine;
+    b = std::sin(t * angle) / sine;
+  } else {
+    // Nearly parallel rotations; fall back to normalized linear interpolation
+    a = 1 - t;
+    b = t;
+  }
+  b *= sign;
+  Quaternion<T> result{
+    a * from.x + b * to.x,
+    a * from.y + b * to.y,
+    a * from.z + b * to.z,
+    a * from.w + b * to.w
+  };
+  const auto norm = std::sqrt(result.x * result.x + result.y * result.y +
+                              result.z * result.z + result.w * result.w);
+  if (norm > 0) {
+    result.x /= norm;
+    result.y /= norm;
+    result.z /= norm;
+    result.w /= norm;
+  }
+  return result;
+}
+
+}  // namespace tween
+}  // namespace takram
+
+#endif  // TAKRAM_TWEEN_QUATERNION_H_
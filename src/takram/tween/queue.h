@@ -0,0 +1,121 @@
+//
+//  takram/tween/queue.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_TWEEN_QUEUE_H_
+#define TAKRAM_TWEEN_QUEUE_H_
+
+#include <atomic>
+#include <utility>
+
+namespace takram {
+namespace tween {
+
+// Queue is a lock-free multiple-producer single-consumer queue. Producers
+// push onto an atomic list, and the consumer takes the whole list at once
+// and processes it in the order of pushes.
+template <class T>
+class Queue final {
+ public:
+  Queue() : head_(nullptr) {}
+  ~Queue();
+
+  // Disallow copy semantics
+  Queue(const Queue&) = delete;
+  Queue& operator=(const Queue&) = delete;
+
+  // Producer
+  void push(T value);
+
+  // Consumer
+  template <class Function>
+  void drain(Function function);
+  bool empty() const;
+
+ private:
+  struct Node {
+    T value;
+    Node *next;
+  };
+
+ private:
+  std::atomic<Node *> head_;
+};
+
+#pragma mark -
+
+template <class T>
+inline Queue<T>::~Queue() {
+  auto node = head_.exchange(nullptr);
+  while (node) {
+    const auto next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+#pragma mark Producer
+
+template <class T>
+inline void Queue<T>::push(T value) {
+  const auto node = new Node{std::move(value), head_.load()};
+  while (!head_.compare_exchange_weak(node->next, node,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {}
+}
+
+#pragma mark Consumer
+
+template <class T>
+template <class Function>
+inline void Queue<T>::drain(Function function) {
+  auto node = head_.exchange(nullptr, std::memory_order_acquire);
+
+  // Reverse the list to process values in the order of pushes
+  Node *first = nullptr;
+  while (node) {
+    const auto next = node->next;
+    node->next = first;
+    first = node;
+    node = next;
+  }
+  while (first) {
+    const auto next = first->next;
+    function(std::move(first->value));
+    delete first;
+    first = next;
+  }
+}
+
+template <class T>
+inline bool Queue<T>::empty() const {
+  return !head_.load(std::memory_order_acquire);
+}
+
+}  // namespace tween
+}  // namespace takram
+
+#endif  // TAKRAM_TWEEN_QUEUE_H_
@@ -0,0 +1,203 @@
+//
+//  takram/tween/sequence_adaptor.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_TWEEN_SEQUENCE_ADAPTOR_H_
+#define TAKRAM_TWEEN_SEQUENCE_ADAPTOR_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+#include "takram/tween/adaptor.h"
+#include "takram/tween/easing.h"
+#include "takram/tween/hash.h"
+#include "takram/tween/types.h"
+
+namespace takram {
+namespace tween {
+
+// SequenceAdaptor runs its children one after another from a single entry of
+// the timeline, each starting on the same update the previous one finishes.
+// Its duration is the sum of the delays and spans of the children when it is
+// constructed, and its easing, which should not go back and forth, eases the
+// progress through the whole sequence. Repeating the sequence replays the
+// children from the starting values they took in the first cycle, and yoyo
+// sequences run them backwards in reverse order. Children must not be started
+// on their own, nor repeat infinitely.
+template <class Interval_>
+class SequenceAdaptor : public Adaptor<Interval_> {
+ public:
+  using Interval = Interval_;
+  using Children = std::vector<std::shared_ptr<Adaptor<Interval>>>;
+
+ public:
+  explicit SequenceAdaptor(const Children& children,
+                           const Easing& easing = LinearEasing::In,
+                           const Interval& delay = Interval(),
+                           const Callback& callback = nullptr);
+
+  // Disallow copy semantics
+  SequenceAdaptor(const SequenceAdaptor&) = delete;
+  SequenceAdaptor& operator=(const SequenceAdaptor&) = delete;
+
+  // Move semantics
+  SequenceAdaptor(SequenceAdaptor&&) = default;
+
+  // Controlling the adaptor
+  using Adaptor<Interval>::update;
+
+  // Hash
+  std::size_t object_hash() const override;
+  std::size_t target_hash() const override;
+
+  // Batch update
+  typename Adaptor<Interval>::Batch batch() const override;
+
+  // Scheduling. Children may share their targets with other adaptors.
+  bool concurrent() const override { return false; }
+
+  // Parameters
+  const Children& children() const { return children_; }
+  std::size_t current() const { return current_; }
+
+ protected:
+  // Updates against the local unit time
+  void update(Unit unit) override;
+
+ private:
+  friend class Adaptor<Interval>;
+
+  static Interval sum(const Children& children);
+
+  // Data members
+  Children children_;
+  std::vector<Unit> offsets_;
+  std::size_t current_;
+};
+
+#pragma mark -
+
+template <class Interval>
+inline SequenceAdaptor<Interval>::SequenceAdaptor(
+    const Children& children,
+    const Easing& easing,
+    const Interval& delay,
+    const Callback& callback)
+    : Adaptor<Interval>(easing, sum(children), delay, callback),
+      children_(children),
+      current_() {
+  Interval offset;
+  offsets_.reserve(children_.size());
+  for (const auto& child : children_) {
+    assert(child);
+    assert(child->repeat() != Adaptor<Interval>::infinite);
+    offsets_.emplace_back(static_cast<Unit>(offset.count()));
+    offset += child->delay() + child->span();
+  }
+}
+
+template <class Interval>
+inline Interval SequenceAdaptor<Interval>::sum(const Children& children) {
+  Interval result;
+  for (const auto& child : children) {
+    result += child->delay() + child->span();
+  }
+  return result;
+}
+
+#pragma mark Updates against the local unit time
+
+template <class Interval>
+inline void SequenceAdaptor<Interval>::update(Unit unit) {
+  if (children_.empty()) {
+    return;
+  }
+  auto elapsed = -std::numeric_limits<Unit>::infinity();
+  if (unit < 0.0) {
+    if (!this->begun()) {
+      return;
+    }
+  } else if (!this->duration().empty() && unit < 1.0) {
+    elapsed = this->easing()(unit) *
+        static_cast<Unit>(this->duration().count());
+  } else {
+    // Finish every child at the end regardless of rounding in the offsets
+    elapsed = std::numeric_limits<Unit>::infinity();
+  }
+  // Rewind the children that start after the elapsed time, which has gone
+  // back when repeating, running backwards or seeking, in reverse order so
+  // that earlier children restore their starting values last
+  current_ = std::min(current_, children_.size() - 1);
+  for (; current_ && elapsed < offsets_[current_]; --current_) {
+    Adaptor<Interval>::update(*children_[current_],
+                              elapsed - offsets_[current_]);
+  }
+  // Children before the current one have finished, and those after the first
+  // unfinished one have yet to be reached
+  for (; current_ < children_.size(); ++current_) {
+    auto& child = *children_[current_];
+    Adaptor<Interval>::update(child, elapsed - offsets_[current_]);
+    if (!child.finished()) {
+      break;
+    }
+  }
+}
+
+#pragma mark Hash
+
+// Sequences may drive several targets, so they are identified by the address
+// of the adaptor itself as timers are.
+
+template <class Interval>
+inline std::size_t SequenceAdaptor<Interval>::object_hash() const {
+  return Hash(this);
+}
+
+template <class Interval>
+inline std::size_t SequenceAdaptor<Interval>::target_hash() const {
+  return Hash(this);
+}
+
+#pragma mark Batch update
+
+template <class Interval>
+inline typename Adaptor<Interval>::Batch
+    SequenceAdaptor<Interval>::batch() const {
+  if (typeid(*this) != typeid(SequenceAdaptor)) {
+    return nullptr;
+  }
+  return &Adaptor<Interval>::template update<SequenceAdaptor>;
+}
+
+}  // namespace tween
+}  // namespace takram
+
+#endif  // TAKRAM_TWEEN_SEQUENCE_ADAPTOR_H_
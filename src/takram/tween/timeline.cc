@@ -29,8 +29,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -47,105 +49,665 @@ void Timeline<Interval>::add(Adaptor adaptor, bool overwrite) {
   const auto object = adaptor->object_hash();
   const auto target = adaptor->target_hash();
   std::lock_guard<std::recursive_mutex> lock(*mutex_);
-  if (objects_.find(object) == objects_.end()) {
-    auto& targets = objects_.emplace(object, Targets()).first->second;
-    targets.emplace(target, adaptor);
-  } else {
-    auto& targets = objects_.at(object);
-    if (overwrite) {
-      targets.erase(target);
+  while (overwrite) {
+    const auto range = index_.equal_range(object);
+    const auto itr = std::find_if(
+        range.first, range.second,
+        [this, target](const std::pair<std::size_t, Location>& pair) {
+          const auto& location = pair.second;
+          return groups_[location.group].target_hashes[location.position] ==
+              target;
+        });
+    if (itr == range.second) {
+      break;
     }
-    targets.emplace(target, adaptor);
+    erase(itr->second);
   }
+  insert(std::move(adaptor), object, target);
 }
 
 template <class Interval>
 void Timeline<Interval>::remove(Adaptor adaptor) {
   assert(adaptor);
-  const auto object = adaptor->object_hash();
   std::lock_guard<std::recursive_mutex> lock(*mutex_);
-  if (objects_.find(object) != objects_.end()) {
-    auto& targets = objects_.at(object);
-    const auto itr = std::find_if(
-        targets.begin(), targets.end(),
-        [&adaptor](const std::pair<std::size_t, Adaptor>& pair) {
-          return pair.second == adaptor;
-        });
-    if (itr != targets.end()) {
-      targets.erase(itr);
-      if (targets.empty()) {
-        objects_.erase(object);
-      }
-    }
+  const auto itr = find(adaptor);
+  if (itr != index_.end()) {
+    erase(itr->second);
   }
 }
 
 template <class Interval>
 bool Timeline<Interval>::contains(Adaptor adaptor) const {
   assert(adaptor);
-  const auto object = adaptor->object_hash();
   std::lock_guard<std::recursive_mutex> lock(*mutex_);
-  if (objects_.find(object) != objects_.end()) {
-    const auto& targets = objects_.at(object);
-    const auto itr = std::find_if(
-        targets.begin(), targets.end(),
-        [&adaptor](const std::pair<std::size_t, Adaptor>& pair) {
-          return pair.second == adaptor;
-        });
-    return itr != targets.end();
-  }
-  return false;
+  return find(adaptor) != index_.end();
 }
 
 template <class Interval>
 void Timeline<Interval>::clear() {
   std::lock_guard<std::recursive_mutex> lock(*mutex_);
-  return objects_.clear();
+  groups_.clear();
+  index_.clear();
+  deadlines_.clear();
+  wakeups_.clear();
+  unscheduled_.clear();
+  deferred_size_ = 0;
 }
 
 template <class Interval>
 bool Timeline<Interval>::empty() const {
   std::lock_guard<std::recursive_mutex> lock(*mutex_);
-  return objects_.empty();
+  return index_.empty();
 }
 
-#pragma mark Advances the timeline
+#pragma mark Starting and stopping adaptors
 
 template <class Interval>
-Interval Timeline<Interval>::advance() {
-  std::vector<Adaptor> finished_adaptors;
-  std::unique_lock<std::recursive_mutex> lock(*mutex_);
-  const auto now = clock_.advance();
-  for (auto object_itr = objects_.begin(); object_itr != objects_.end();) {
-    auto& targets = object_itr->second;
-    for (auto target_itr = targets.begin(); target_itr != targets.end();) {
-      const auto adaptor = target_itr->second;
+void Timeline<Interval>::start(Adaptor adaptor) {
+  assert(adaptor);
+  const auto owner = commands_->owner.load(std::memory_order_acquire);
+  if (owner != std::thread::id() && owner != std::this_thread::get_id()) {
+    commands_->queue.push(Command{std::move(adaptor), true});
+  } else {
+    std::lock_guard<std::recursive_mutex> lock(*mutex_);
+    execute(Command{std::move(adaptor), true});
+  }
+}
+
+template <class Interval>
+void Timeline<Interval>::stop(Adaptor adaptor) {
+  assert(adaptor);
+  const auto owner = commands_->owner.load(std::memory_order_acquire);
+  if (owner != std::thread::id() && owner != std::this_thread::get_id()) {
+    commands_->queue.push(Command{std::move(adaptor), false});
+  } else {
+    std::lock_guard<std::recursive_mutex> lock(*mutex_);
+    execute(Command{std::move(adaptor), false});
+  }
+}
+
+#pragma mark Commands
+
+template <class Interval>
+void Timeline<Interval>::execute(const Command& command) {
+  const auto& adaptor = command.adaptor;
+  if (command.start) {
+    if (!adaptor->running()) {
+      add(adaptor);
+      adaptor->start(now());
+    }
+  } else {
+    if (adaptor->running()) {
+      adaptor->stop();
+      remove(adaptor);
+    }
+  }
+}
+
+template <class Interval>
+void Timeline<Interval>::drain() {
+  if (!commands_->queue.empty()) {
+    commands_->queue.drain([this](const Command& command) {
+      execute(command);
+    });
+  }
+}
+
+#pragma mark Callback dispatch
+
+template <class Interval>
+std::vector<typename Timeline<Interval>::Adaptor>
+    Timeline<Interval>::acquire() {
+  std::vector<Adaptor> buffer;
+  if (!buffers_.empty()) {
+    buffer.swap(buffers_.back());
+    buffers_.pop_back();
+  }
+  return buffer;
+}
+
+template <class Interval>
+void Timeline<Interval>::release(std::vector<Adaptor> buffer) {
+  assert(buffer.empty());
+  buffers_.emplace_back(std::move(buffer));
+}
+
+#pragma mark Storage
+
+template <class Interval>
+void Timeline<Interval>::insert(Adaptor adaptor,
+                                std::size_t object,
+                                std::size_t target) {
+  const auto batch = adaptor->batch();
+  const auto easing = batch ? adaptor->easing() : Easing();
+  const auto deferred = adaptor->deferrable();
+  const auto concurrent = adaptor->concurrent();
+  auto vacant = groups_.end();
+  auto group = groups_.begin();
+  for (; group != groups_.end(); ++group) {
+    if (group->adaptors.empty()) {
+      if (vacant == groups_.end()) {
+        vacant = group;
+      }
+    } else if (group->batch == batch && group->easing == easing &&
+               group->deferred == deferred &&
+               group->concurrent == concurrent) {
+      break;
+    }
+  }
+  if (group == groups_.end()) {
+    if (vacant != groups_.end()) {
+      // Reuse an empty group so that the groups do not grow with every
+      // distinct easing that has ever been added
+      group = vacant;
+      assert(!group->awake);
+      group->batch = batch;
+      group->easing = easing;
+      group->deferred = deferred;
+      group->concurrent = concurrent;
+    } else {
+      group = groups_.insert(groups_.end(),
+                             Group(batch, easing, deferred, concurrent));
+    }
+  }
+  if (deferred) {
+    // Adaptors are usually started after being added, so their deadlines are
+    // not known until the next advance
+    unscheduled_.emplace_back(adaptor);
+    ++deferred_size_;
+  }
+  const Location location{
+    static_cast<std::size_t>(group - groups_.begin()),
+    group->adaptors.size()
+  };
+  index_.emplace(object, location);
+  group->adaptors.emplace_back(std::move(adaptor));
+  group->object_hashes.emplace_back(object);
+  group->target_hashes.emplace_back(target);
+  if (!deferred) {
+    // New adaptors are awake until they are found to be in their delays
+    swap(location.group, location.position, group->awake++);
+  }
+}
+
+template <class Interval>
+void Timeline<Interval>::erase(Location location) {
+  assert(location.group < groups_.size());
+  auto& group = groups_[location.group];
+  auto position = location.position;
+  assert(position < group.adaptors.size());
+  if (position < group.awake) {
+    // Move the adaptor to the end of the awake ones to keep them contiguous
+    swap(location.group, position, --group.awake);
+    position = group.awake;
+    location.position = position;
+  }
+  index_.erase(find(group.object_hashes[position], location));
+  if (group.deferred) {
+    --deferred_size_;
+  }
+  const auto last = group.adaptors.size() - 1;
+  if (position != last) {
+    // Move the last element into the vacated position to keep arrays dense
+    find(group.object_hashes[last], {location.group, last})->second = location;
+    group.adaptors[position] = std::move(group.adaptors[last]);
+    group.object_hashes[position] = group.object_hashes[last];
+    group.target_hashes[position] = group.target_hashes[last];
+  }
+  group.adaptors.pop_back();
+  group.object_hashes.pop_back();
+  group.target_hashes.pop_back();
+  if (group.adaptors.empty()) {
+    // Release the easing, which may share the state of its function, and
+    // leave the group to be reused by the next insertion of any key
+    group.batch = nullptr;
+    group.easing = Easing();
+  }
+}
+
+template <class Interval>
+typename Timeline<Interval>::Index::iterator Timeline<Interval>::find(
+    std::size_t object,
+    const Location& location) {
+  const auto range = index_.equal_range(object);
+  const auto itr = std::find_if(
+      range.first, range.second,
+      [&location](const std::pair<std::size_t, Location>& pair) {
+        return (pair.second.group == location.group &&
+                pair.second.position == location.position);
+      });
+  assert(itr != range.second);
+  return itr;
+}
+
+template <class Interval>
+typename Timeline<Interval>::Index::const_iterator Timeline<Interval>::find(
+    const Adaptor& adaptor) const {
+  const auto range = index_.equal_range(adaptor->object_hash());
+  const auto itr = std::find_if(
+      range.first, range.second,
+      [this, &adaptor](const std::pair<std::size_t, Location>& pair) {
+        const auto& location = pair.second;
+        return groups_[location.group].adaptors[location.position] == adaptor;
+      });
+  return itr != range.second ? itr : index_.end();
+}
+
+template <class Interval>
+void Timeline<Interval>::swap(std::size_t group, std::size_t a, std::size_t b) {
+  auto& arrays = groups_[group];
+  // Every change to the awake adaptors comes through here, even when nothing
+  // moves but their number
+  arrays.partitioned = false;
+  if (a == b) {
+    return;
+  }
+  const auto first = find(arrays.object_hashes[a], {group, a});
+  const auto second = find(arrays.object_hashes[b], {group, b});
+  first->second.position = b;
+  second->second.position = a;
+  std::swap(arrays.adaptors[a], arrays.adaptors[b]);
+  std::swap(arrays.object_hashes[a], arrays.object_hashes[b]);
+  std::swap(arrays.target_hashes[a], arrays.target_hashes[b]);
+}
+
+#pragma mark Updating
+
+template <class Interval>
+void Timeline<Interval>::update(const Interval& now) {
+  for (const auto& group : groups_) {
+    if (!group.deferred) {
+      update(now, group, 0, group.awake);
+    }
+  }
+}
+
+template <class Interval>
+void Timeline<Interval>::update(const Interval& now,
+                                std::size_t partition,
+                                std::size_t count) {
+  for (const auto& group : groups_) {
+    if (!group.deferred && group.concurrent) {
+      assert(group.partitioned && group.partitions.size() == count + 1);
+      update(now, group, group.partitions[partition],
+             group.partitions[partition + 1]);
+    }
+  }
+}
+
+template <class Interval>
+void Timeline<Interval>::update(const Interval& now,
+                                const Group& group,
+                                std::size_t first,
+                                std::size_t last) {
+  if (first == last) {
+    return;
+  }
+  const auto& adaptors = group.adaptors;
+  if (group.batch) {
+    group.batch(adaptors.data() + first, last - first, now);
+  } else {
+    for (auto position = first; position < last; ++position) {
+      const auto& adaptor = adaptors[position];
       assert(adaptor);
       if (adaptor->running()) {
         adaptor->update(now, false);
       }
-      if (adaptor->finished()) {
-        targets.erase(target_itr++);
-        finished_adaptors.emplace_back(adaptor);
-      } else {
-        ++target_itr;
+    }
+  }
+}
+
+template <class Interval>
+void Timeline<Interval>::partition(std::size_t count) {
+  // Adaptors of the same object always fall into the same partition, so
+  // that no two threads update the same object at once. Object hashes are
+  // often aligned addresses; scramble them before taking the remainder.
+  const auto partition_of = [count](std::size_t object) {
+    const auto scrambled =
+        static_cast<std::uint64_t>(object) * UINT64_C(0x9e3779b97f4a7c15);
+    return static_cast<std::size_t>(scrambled >> 32) % count;
+  };
+  auto& keys = partition_keys_;
+  auto& ends = partition_ends_;
+  for (std::size_t index = 0; index < groups_.size(); ++index) {
+    auto& group = groups_[index];
+    if (group.deferred || !group.concurrent ||
+        (group.partitioned && group.partitions.size() == count + 1)) {
+      continue;
+    }
+    // Count the adaptors of each partition to find where the partitions
+    // begin, and swap every adaptor into the next free position of its own
+    // partition, which moves each of them at most once
+    auto& offsets = group.partitions;
+    offsets.assign(count + 1, 0);
+    keys.resize(group.awake);
+    for (std::size_t position = 0; position < group.awake; ++position) {
+      keys[position] = partition_of(group.object_hashes[position]);
+      ++offsets[keys[position] + 1];
+    }
+    for (std::size_t partition = 0; partition < count; ++partition) {
+      offsets[partition + 1] += offsets[partition];
+    }
+    ends.assign(offsets.begin(), offsets.end() - 1);
+    for (std::size_t partition = 0; partition < count; ++partition) {
+      while (ends[partition] < offsets[partition + 1]) {
+        const auto position = ends[partition];
+        const auto key = keys[position];
+        if (key == partition) {
+          ++ends[partition];
+        } else {
+          const auto destination = ends[key]++;
+          swap(index, position, destination);
+          std::swap(keys[position], keys[destination]);
+        }
       }
     }
-    if (targets.empty()) {
-      objects_.erase(object_itr++);
+    group.partitioned = true;
+  }
+}
+
+#pragma mark Scheduling
+
+template <class Interval>
+void Timeline<Interval>::schedule(Adaptor adaptor) {
+  const auto time = adaptor->deadline();
+  deadlines_.emplace_back(Deadline{time, std::move(adaptor)});
+  std::push_heap(deadlines_.begin(), deadlines_.end(), Later());
+}
+
+template <class Interval>
+void Timeline<Interval>::expire(const Interval& now,
+                                std::vector<Adaptor> *finished_adaptors) {
+  // Schedule adaptors that have been started since the last advance, and
+  // leave those that are not yet running for the next one
+  std::size_t size = 0;
+  for (auto& adaptor : unscheduled_) {
+    const auto itr = find(adaptor);
+    if (itr == index_.end()) {
+      continue;
+    } else if (adaptor->finished()) {
+      erase(itr->second);
+      finished_adaptors->emplace_back(std::move(adaptor));
+    } else if (adaptor->running()) {
+      schedule(std::move(adaptor));
     } else {
-      ++object_itr;
+      unscheduled_[size++] = std::move(adaptor);
     }
   }
-  lock.unlock();
-  for (auto& adaptor : finished_adaptors) {
-    if (adaptor->callback()) {
-      adaptor->callback()();
+  unscheduled_.resize(size);
+
+  // Entries of removed adaptors are left in the heap until they expire, but
+  // discard them once they outnumber the live ones
+  if (deadlines_.size() > 2 * deferred_size_ + 64) {
+    deadlines_.erase(std::remove_if(
+        deadlines_.begin(), deadlines_.end(),
+        [this](const Deadline& deadline) {
+          return find(deadline.adaptor) == index_.end();
+        }), deadlines_.end());
+    std::make_heap(deadlines_.begin(), deadlines_.end(), Later());
+  }
+
+  while (!deadlines_.empty() && !(now < deadlines_.front().time)) {
+    std::pop_heap(deadlines_.begin(), deadlines_.end(), Later());
+    auto deadline = std::move(deadlines_.back());
+    deadlines_.pop_back();
+    auto& adaptor = deadline.adaptor;
+    const auto itr = find(adaptor);
+    if (itr == index_.end()) {
+      continue;  // Removed
+    } else if (!adaptor->running()) {
+      unscheduled_.emplace_back(std::move(adaptor));
+      continue;  // Stopped without being removed
+    } else if (adaptor->deadline() != deadline.time) {
+      schedule(std::move(adaptor));
+      continue;  // Restarted or modified
+    }
+    adaptor->update(now, false);
+    if (adaptor->finished()) {
+      erase(itr->second);
+      finished_adaptors->emplace_back(std::move(adaptor));
+    } else {
+      // Rounding may leave the adaptor short of its deadline; retry it on the
+      // next advance
+      unscheduled_.emplace_back(std::move(adaptor));
     }
   }
+}
+
+template <class Interval>
+void Timeline<Interval>::park(std::size_t group, std::size_t position) {
+  auto& arrays = groups_[group];
+  assert(position < arrays.awake);
+  const auto& adaptor = arrays.adaptors[position];
+  wakeups_.emplace_back(Deadline{adaptor->wakeup(), adaptor});
+  std::push_heap(wakeups_.begin(), wakeups_.end(), Later());
+  swap(group, position, --arrays.awake);
+}
+
+template <class Interval>
+void Timeline<Interval>::wake(const Interval& now) {
+  // Entries of removed adaptors are discarded as they come up. An adaptor
+  // that is restarted while sleeping is woken up at its former wakeup time,
+  // and parked again if it is still in its delay.
+  while (!wakeups_.empty() && !(now < wakeups_.front().time)) {
+    std::pop_heap(wakeups_.begin(), wakeups_.end(), Later());
+    const auto adaptor = std::move(wakeups_.back().adaptor);
+    wakeups_.pop_back();
+    const auto itr = find(adaptor);
+    if (itr != index_.end()) {
+      const auto location = itr->second;
+      auto& group = groups_[location.group];
+      if (location.position >= group.awake) {
+        swap(location.group, location.position, group.awake++);
+        adaptor->wake();
+      }
+    }
+  }
+  if (wakeups_.size() > 2 * index_.size() + 64) {
+    wakeups_.erase(std::remove_if(
+        wakeups_.begin(), wakeups_.end(),
+        [this](const Deadline& deadline) {
+          return find(deadline.adaptor) == index_.end();
+        }), wakeups_.end());
+    std::make_heap(wakeups_.begin(), wakeups_.end(), Later());
+  }
+}
+
+#pragma mark Advances the timeline
+
+template <class Interval>
+Interval Timeline<Interval>::advance() {
+  std::unique_lock<std::recursive_mutex> lock(*mutex_);
+  drain();
+  const auto previous = clock_.now();
+  const auto now = clock_.advance();
+  // Fixed steps leave the time as it is until a whole step accumulates, in
+  // which case there is nothing to update
+  if (now != previous || clock_.fixed_step().empty()) {
+    tick(now, &lock);
+  }
   return now;
 }
 
+template <class Interval>
+Interval Timeline<Interval>::advance(const Interval& now) {
+  std::unique_lock<std::recursive_mutex> lock(*mutex_);
+  drain();
+  const auto time = clock_.advance(now);
+  tick(time, &lock);
+  return time;
+}
+
+template <class Interval>
+void Timeline<Interval>::tick(const Interval& now,
+                              std::unique_lock<std::recursive_mutex> *lock,
+                              bool seeking) {
+  auto finished_adaptors = acquire();
+  wake(now);
+  if (seeking) {
+    // Hold the adaptors that reach their ends rather than finishing them, so
+    // that seeking back brings them back. Deferred adaptors have nothing to
+    // hold, and are left to the next advance.
+    for (auto& group : groups_) {
+      if (!group.deferred) {
+        for (std::size_t position = 0; position < group.awake; ++position) {
+          group.adaptors[position]->seek(now);
+        }
+      }
+    }
+  } else if (workers_) {
+    partition(workers_->concurrency());
+    // Keep the captures small enough for the function not to allocate
+    workers_->run([this, &now](std::size_t partition) {
+      update(now, partition, workers_->concurrency());
+    });
+    // Adaptors that are not concurrent may share their targets with those of
+    // any partition
+    for (const auto& group : groups_) {
+      if (!group.deferred && !group.concurrent) {
+        update(now, group, 0, group.awake);
+      }
+    }
+  } else {
+    update(now);
+  }
+  for (std::size_t index = 0; index < groups_.size(); ++index) {
+    auto& group = groups_[index];
+    if (group.deferred) {
+      continue;
+    }
+    auto& adaptors = group.adaptors;
+    for (std::size_t position = 0; position < group.awake;) {
+      const auto& adaptor = adaptors[position];
+      if (adaptor->finished()) {
+        // Move the adaptor out rather than copying it to save reference
+        // counting; erase() does not touch the vacated element
+        finished_adaptors.emplace_back(std::move(adaptors[position]));
+        erase({index, position});
+      } else if (adaptor->running() && now < adaptor->wakeup()) {
+        park(index, position);
+      } else {
+        ++position;
+      }
+    }
+  }
+  if (!seeking) {
+    expire(now, &finished_adaptors);
+  }
+
+  // Dispatch the callbacks deferred on the last advance, and defer those of
+  // this one if requested
+  if (callbacks_deferred_) {
+    std::swap(finished_adaptors, deferred_callbacks_);
+  } else if (!deferred_callbacks_.empty()) {
+    finished_adaptors.insert(finished_adaptors.begin(),
+                             deferred_callbacks_.begin(),
+                             deferred_callbacks_.end());
+    deferred_callbacks_.clear();
+  }
+  std::shared_ptr<const Executor> executor;
+  if (!finished_adaptors.empty()) {
+    executor = executor_;
+  }
+  lock->unlock();
+  for (const auto& adaptor : finished_adaptors) {
+    const auto& callback = adaptor->callback();
+    if (!callback) {
+      continue;
+    } else if (executor) {
+      (*executor)(callback);
+    } else {
+      callback();
+    }
+  }
+  finished_adaptors.clear();
+  lock->lock();
+  release(std::move(finished_adaptors));
+}
+
+#pragma mark Playback
+
+template <class Interval>
+void Timeline<Interval>::pause() {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  clock_.pause();
+}
+
+template <class Interval>
+void Timeline<Interval>::resume() {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  clock_.resume();
+}
+
+template <class Interval>
+bool Timeline<Interval>::paused() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return clock_.paused();
+}
+
+template <class Interval>
+Unit Timeline<Interval>::rate() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return clock_.rate();
+}
+
+template <class Interval>
+void Timeline<Interval>::set_rate(Unit value) {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  clock_.set_rate(value);
+}
+
+template <class Interval>
+Interval Timeline<Interval>::fixed_step() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return clock_.fixed_step();
+}
+
+template <class Interval>
+void Timeline<Interval>::set_fixed_step(const Interval& value) {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  clock_.set_fixed_step(value);
+}
+
+template <class Interval>
+std::size_t Timeline<Interval>::max_steps() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return clock_.max_steps();
+}
+
+template <class Interval>
+void Timeline<Interval>::set_max_steps(std::size_t value) {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  clock_.set_max_steps(value);
+}
+
+template <class Interval>
+Unit Timeline<Interval>::alpha() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return clock_.alpha();
+}
+
+template <class Interval>
+TimeSource Timeline<Interval>::time_source() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return clock_.source();
+}
+
+template <class Interval>
+void Timeline<Interval>::set_time_source(TimeSource value) {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  clock_.set_source(value);
+}
+
+template <class Interval>
+Interval Timeline<Interval>::seek(const Interval& time) {
+  std::unique_lock<std::recursive_mutex> lock(*mutex_);
+  drain();
+  clock_.seek(time);
+  tick(time, &lock, true);
+  return time;
+}
+
 template class Timeline<Time>;
 template class Timeline<Frame>;
 
@@ -32,16 +32,22 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "takram/tween/adaptor.h"
 #include "takram/tween/clock.h"
 #include "takram/tween/hash.h"
 #include "takram/tween/interval.h"
+#include "takram/tween/pool.h"
+#include "takram/tween/queue.h"
 #include "takram/tween/timer.h"
 #include "takram/tween/tween.h"
+#include "takram/tween/workers.h"
 
 namespace takram {
 namespace tween {
@@ -52,8 +58,78 @@ class Timeline final {
   using Interval = Interval_;
 
  private:
+  using Batch = typename Adaptor<Interval>::Batch;
   using Adaptor = std::shared_ptr<Adaptor<Interval>>;
-  using Targets = std::unordered_multimap<std::size_t, Adaptor>;
+
+  // Adaptors that share the same batch update function and the same easing
+  // are stored together in parallel arrays, so that advancing the
+  // timeline is a linear sweep over contiguous memory for each group. Awake
+  // adaptors come first in the arrays, followed by those sleeping until their
+  // delays elapse. Groups that become empty are reused for the next key
+  // inserted, so their number is bounded by the keys in use at once. For
+  // parallel updates, the awake adaptors of concurrent groups are sorted by
+  // their partitions, which begin at the offsets in the partitions array.
+  // Reordering the awake adaptors leaves them to be sorted again.
+  struct Group {
+    Group(Batch batch, const Easing& easing, bool deferred, bool concurrent)
+        : batch(batch),
+          easing(easing),
+          deferred(deferred),
+          concurrent(concurrent),
+          partitioned(),
+          awake() {}
+
+    Batch batch;
+    Easing easing;
+    bool deferred;
+    bool concurrent;
+    bool partitioned;
+    std::size_t awake;
+    std::vector<Adaptor> adaptors;
+    std::vector<std::size_t> object_hashes;
+    std::vector<std::size_t> target_hashes;
+    std::vector<std::size_t> partitions;
+  };
+
+  struct Location {
+    std::size_t group;
+    std::size_t position;
+  };
+
+  // Deferred adaptors are not updated on every advance. Instead they are kept
+  // in a min-heap ordered by their deadlines, so that advancing the timeline
+  // only touches those whose deadlines have passed. Sleeping adaptors are
+  // woken up in the same way.
+  struct Deadline {
+    Interval time;
+    Adaptor adaptor;
+  };
+
+  struct Later {
+    bool operator()(const Deadline& a, const Deadline& b) const {
+      return b.time < a.time;
+    }
+  };
+
+  // Starting and stopping adaptors requested from threads other than the
+  // owner of the timeline
+  struct Command {
+    Adaptor adaptor;
+    bool start;
+  };
+
+  struct Commands {
+    std::atomic<std::thread::id> owner;
+    Queue<Command> queue;
+  };
+
+  using Index = std::unordered_multimap<
+      std::size_t, Location,
+      std::hash<std::size_t>, std::equal_to<std::size_t>,
+      PoolAllocator<std::pair<const std::size_t, Location>>>;
+
+ public:
+  using Executor = std::function<void(const Callback&)>;
 
  public:
   Timeline();
@@ -85,16 +161,144 @@ class Timeline final {
   void clear();
   bool empty() const;
 
-  // Advances the timeline
+  // Starting and stopping adaptors. When the timeline has an owner thread,
+  // calls from other threads are queued without locking and take effect at
+  // the beginning of the next advance on the owner thread.
+  void start(Adaptor adaptor);
+  void stop(Adaptor adaptor);
+  std::thread::id owner() const;
+  void set_owner(std::thread::id value);
+
+  // Advances the timeline. Advancing to a time given, such as the time of a
+  // clock sampled once for many timelines, updates the adaptors at that time
+  // without reading the clock of the timeline. Paused timelines keep their
+  // time, while the rate and the fixed step apply only to advances that read
+  // the clock. Adaptors start at the time of the timeline, so a timeline fed
+  // by a shared clock should be advanced to its time before adding them.
   Interval advance();
+  Interval advance(const Interval& now);
   Interval now() const { return clock_.now(); }
 
+  // Playback. A paused timeline keeps its time on advances, and the rate
+  // scales the time that advances add. Seeking moves the time and updates the
+  // adaptors at the new time in a single pass, without replaying the time in
+  // between. Running adaptors give the same values for the same times however
+  // they are sought, restoring the starting values they took on leaving their
+  // delays when moved back into them. Adaptors sought past their ends hold
+  // their end values and stay in the timeline, so that seeking back before
+  // their ends brings them back. They finish, and their callbacks are called,
+  // on the next advance past their ends.
+  void pause();
+  void resume();
+  bool paused() const;
+  Unit rate() const;
+  void set_rate(Unit value);
+  Interval seek(const Interval& time);
+
+  // Fixed step. When the step is not empty, advances move the time by whole
+  // steps of the time accumulated since the last one, and update the adaptors
+  // once at the last step, as only the final values are observable. Advances
+  // that accumulate less than a step leave the adaptors as they are. The
+  // alpha is the fraction of the next step accumulated, for interpolating
+  // rendered states. Steps beyond the maximum count, unless it is zero, are
+  // dropped to recover from hitches.
+  Interval fixed_step() const;
+  void set_fixed_step(const Interval& value);
+  std::size_t max_steps() const;
+  void set_max_steps(std::size_t value);
+  Unit alpha() const;
+
+  // Time source. Timelines of time read monotonic nanoseconds from the
+  // steady clock by default, and the source can be replaced by a cheaper clock
+  // or a user function without a jump in the time. Timelines of frames ignore
+  // the source.
+  TimeSource time_source() const;
+  void set_time_source(TimeSource value);
+
+  // Memory
+  PoolAllocator<void> allocator() const;
+
+  // Callback dispatch. Callbacks of finished adaptors are called on the
+  // advancing thread after the timeline is unlocked, or on the next advance
+  // when deferred. When an executor is set, callbacks are handed to it
+  // instead of being called.
+  Executor executor() const;
+  void set_executor(const Executor& value);
+  bool callbacks_deferred() const;
+  void set_callbacks_deferred(bool value);
+
+  // Parallelism. When the concurrency is more than one, advancing the
+  // timeline partitions the adaptors by their objects and updates the
+  // partitions in parallel. Adaptors of different objects must not share
+  // mutable state in that case. Adaptors that are not concurrent, such as
+  // sequences and parallel adaptors, are updated on the calling thread after
+  // the others. Callbacks are still called sequentially.
+  std::size_t concurrency() const;
+  void set_concurrency(std::size_t value);
+
  private:
   static void deleteShared();
 
+  // Storage
+  void insert(Adaptor adaptor, std::size_t object, std::size_t target);
+  void erase(Location location);
+  typename Index::iterator find(std::size_t object, const Location& location);
+  typename Index::const_iterator find(const Adaptor& adaptor) const;
+  void swap(std::size_t group, std::size_t a, std::size_t b);
+
+  // Updating. Ticking updates the adaptors at the given time and dispatches
+  // the callbacks of the finished ones, unlocking the timeline meanwhile.
+  void tick(const Interval& now,
+            std::unique_lock<std::recursive_mutex> *lock,
+            bool seeking = false);
+  void update(const Interval& now);
+  void update(const Interval& now, std::size_t partition, std::size_t count);
+  void update(const Interval& now,
+              const Group& group,
+              std::size_t first,
+              std::size_t last);
+  void partition(std::size_t count);
+
+  // Commands
+  void execute(const Command& command);
+  void drain();
+
+  // Callback dispatch
+  std::vector<Adaptor> acquire();
+  void release(std::vector<Adaptor> buffer);
+
+  // Scheduling
+  void schedule(Adaptor adaptor);
+  void expire(const Interval& now, std::vector<Adaptor> *finished_adaptors);
+  void park(std::size_t group, std::size_t position);
+  void wake(const Interval& now);
+
  private:
-  std::unordered_map<std::size_t, Targets> objects_;
+  // The pool backs the index nodes and the adaptors that tweens and timers
+  // create for this timeline. Allocators share the ownership of the pool, so
+  // adaptors may safely outlive the timeline.
+  std::shared_ptr<Pool> pool_;
+
+  // The index maps object hashes to locations in the groups and is used only
+  // for lookups.
+  std::vector<Group> groups_;
+  Index index_;
+  std::vector<Deadline> deadlines_;
+  std::vector<Deadline> wakeups_;
+  std::vector<Adaptor> unscheduled_;
+  std::size_t deferred_size_;
   Clock<Interval> clock_;
+  std::unique_ptr<Workers> workers_;
+  std::vector<std::size_t> partition_keys_;
+  std::vector<std::size_t> partition_ends_;
+  std::unique_ptr<Commands> commands_;
+
+  // Buffers of finished adaptors are recycled so that advancing the timeline
+  // does not allocate once they have grown enough.
+  std::vector<std::vector<Adaptor>> buffers_;
+  std::vector<Adaptor> deferred_callbacks_;
+  std::shared_ptr<const Executor> executor_;
+  bool callbacks_deferred_;
   std::unique_ptr<std::recursive_mutex> mutex_;
   static std::atomic<Timeline *> shared_;
   static std::mutex shared_mutex_;
@@ -112,7 +316,13 @@ bool Timeline<Interval>::shared_deleted_;
 
 template <class Interval>
 inline Timeline<Interval>::Timeline()
-    : mutex_(std::make_unique<std::recursive_mutex>()) {}
+    : pool_(std::make_shared<Pool>()),
+      index_(0, typename Index::hasher(), typename Index::key_equal(),
+             typename Index::allocator_type(pool_)),
+      deferred_size_(),
+      commands_(std::make_unique<Commands>()),
+      callbacks_deferred_(false),
+      mutex_(std::make_unique<std::recursive_mutex>()) {}
 
 #pragma mark Shared instance
 
@@ -162,15 +372,88 @@ inline tween::Timer<Interval> Timeline<Interval>::timer(Args&&... args) {
 template <class Interval>
 template <class T>
 inline void Timeline<Interval>::remove(const T *object) {
+  const auto hash = Hash(object);
   std::lock_guard<std::recursive_mutex> lock(*mutex_);
-  objects_.erase(Hash(object));
+  for (auto itr = index_.find(hash); itr != index_.end();
+       itr = index_.find(hash)) {
+    erase(itr->second);
+  }
 }
 
 template <class Interval>
 template <class T>
 inline bool Timeline<Interval>::contains(const T *object) const {
   std::lock_guard<std::recursive_mutex> lock(*mutex_);
-  return objects_.find(Hash(object)) != objects_.end();
+  return index_.find(Hash(object)) != index_.end();
+}
+
+#pragma mark Memory
+
+template <class Interval>
+inline PoolAllocator<void> Timeline<Interval>::allocator() const {
+  assert(pool_);
+  return PoolAllocator<void>(pool_);
+}
+
+#pragma mark Starting and stopping adaptors
+
+template <class Interval>
+inline std::thread::id Timeline<Interval>::owner() const {
+  return commands_->owner.load(std::memory_order_acquire);
+}
+
+template <class Interval>
+inline void Timeline<Interval>::set_owner(std::thread::id value) {
+  commands_->owner.store(value, std::memory_order_release);
+}
+
+#pragma mark Callback dispatch
+
+template <class Interval>
+inline typename Timeline<Interval>::Executor
+    Timeline<Interval>::executor() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return executor_ ? *executor_ : Executor();
+}
+
+template <class Interval>
+inline void Timeline<Interval>::set_executor(const Executor& value) {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  if (value) {
+    executor_ = std::make_shared<const Executor>(value);
+  } else {
+    executor_.reset();
+  }
+}
+
+template <class Interval>
+inline bool Timeline<Interval>::callbacks_deferred() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return callbacks_deferred_;
+}
+
+template <class Interval>
+inline void Timeline<Interval>::set_callbacks_deferred(bool value) {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  callbacks_deferred_ = value;
+}
+
+#pragma mark Parallelism
+
+template <class Interval>
+inline std::size_t Timeline<Interval>::concurrency() const {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  return workers_ ? workers_->concurrency() : 1;
+}
+
+template <class Interval>
+inline void Timeline<Interval>::set_concurrency(std::size_t value) {
+  std::lock_guard<std::recursive_mutex> lock(*mutex_);
+  if (value > 1) {
+    workers_ = std::make_unique<Workers>(value);
+  } else {
+    workers_.reset();
+  }
 }
 
 }  // namespace tween
@@ -40,20 +40,14 @@ template <class Interval>
 void Timer<Interval>::start() {
   assert(timeline_);
   assert(adaptor_);
-  if (!adaptor_->running()) {
-    timeline_->add(adaptor_);
-    adaptor_->start(timeline_->now());
-  }
+  timeline_->start(adaptor_);
 }
 
 template <class Interval>
 void Timer<Interval>::stop() {
   assert(timeline_);
   assert(adaptor_);
-  if (adaptor_->running()) {
-    adaptor_->stop();
-    timeline_->remove(adaptor_);
-  }
+  timeline_->stop(adaptor_);
 }
 
 template class Timer<Time>;
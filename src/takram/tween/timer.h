@@ -30,6 +30,7 @@
 
 #include <cassert>
 #include <memory>
+#include <utility>
 
 #include "takram/tween/adaptor.h"
 #include "takram/tween/interval.h"
@@ -94,6 +95,11 @@ class Timer final {
   // Conversion
   operator bool() const { return adaptor_ && timeline_; }
 
+ private:
+  // Allocates adaptors from the pool of the timeline if any
+  template <class T, class... Args>
+  static std::shared_ptr<T> make(Timeline *timeline, Args&&... args);
+
  private:
   Adaptor adaptor_;
   Timeline *timeline_;
@@ -120,9 +126,22 @@ template <class Interval>
 inline Timer<Interval>::Timer(const Interval& duration,
                               const Callback& callback,
                               Timeline *timeline)
-    : adaptor_(std::make_shared<TimerAdaptor<Interval>>(duration, callback)),
+    : adaptor_(make<TimerAdaptor<Interval>>(timeline, duration, callback)),
       timeline_(timeline) {}
 
+#pragma mark Memory
+
+template <class Interval>
+template <class T, class... Args>
+inline std::shared_ptr<T> Timer<Interval>::make(Timeline *timeline,
+                                                Args&&... args) {
+  if (timeline) {
+    return std::allocate_shared<T>(timeline->allocator(),
+                                   std::forward<Args>(args)...);
+  }
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
 #pragma mark Comparison
 
 template <class Interval>
@@ -29,11 +29,11 @@
 #define TAKRAM_TWEEN_TIMER_ADAPTOR_H_
 
 #include <cstddef>
-#include <limits>
-#include <random>
+#include <typeinfo>
 
 #include "takram/tween/adaptor.h"
 #include "takram/tween/easing.h"
+#include "takram/tween/hash.h"
 #include "takram/tween/types.h"
 
 namespace takram {
@@ -61,9 +61,19 @@ class TimerAdaptor : public Adaptor<Interval_> {
   std::size_t object_hash() const override;
   std::size_t target_hash() const override;
 
+  // Batch update
+  typename Adaptor<Interval>::Batch batch() const override;
+
+  // Scheduling. Timers do nothing until they finish, unless subclasses
+  // override update() to do something on the way.
+  bool deferrable() const override;
+
  protected:
   // Updates against the local unit time
   void update(Unit unit) override {}
+
+ private:
+  friend class Adaptor<Interval>;
 };
 
 #pragma mark -
@@ -76,22 +86,36 @@ inline TimerAdaptor<Interval>::TimerAdaptor(
 
 #pragma mark Hash
 
+// Timers have no target, so they are identified by the address of the adaptor
+// itself, which is stable for its lifetime and cannot coincide with a target
+// of other adaptors while it is alive.
+
 template <class Interval>
 inline std::size_t TimerAdaptor<Interval>::object_hash() const {
-  std::mt19937 generator((std::random_device()()));
-  std::uniform_int_distribution<std::size_t> distribution(
-      std::numeric_limits<std::size_t>::min(),
-      std::numeric_limits<std::size_t>::max());
-  return distribution(generator);
+  return Hash(this);
 }
 
 template <class Interval>
 inline std::size_t TimerAdaptor<Interval>::target_hash() const {
-  std::mt19937 generator((std::random_device()()));
-  std::uniform_int_distribution<std::size_t> distribution(
-      std::numeric_limits<std::size_t>::min(),
-      std::numeric_limits<std::size_t>::max());
-  return distribution(generator);
+  return Hash(this);
+}
+
+#pragma mark Batch update
+
+template <class Interval>
+inline typename Adaptor<Interval>::Batch
+    TimerAdaptor<Interval>::batch() const {
+  if (typeid(*this) != typeid(TimerAdaptor)) {
+    return nullptr;
+  }
+  return &Adaptor<Interval>::template update<TimerAdaptor>;
+}
+
+#pragma mark Scheduling
+
+template <class Interval>
+inline bool TimerAdaptor<Interval>::deferrable() const {
+  return typeid(*this) == typeid(TimerAdaptor);
 }
 
 }  // namespace tween
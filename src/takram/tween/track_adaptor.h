@@ -0,0 +1,209 @@
+//
+//  takram/tween/track_adaptor.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_TWEEN_TRACK_ADAPTOR_H_
+#define TAKRAM_TWEEN_TRACK_ADAPTOR_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <typeinfo>
+#include <vector>
+
+#include "takram/tween/adaptor.h"
+#include "takram/tween/easing.h"
+#include "takram/tween/hash.h"
+#include "takram/tween/keyframe.h"
+#include "takram/tween/transform.h"
+#include "takram/tween/types.h"
+
+namespace takram {
+namespace tween {
+
+// TrackAdaptor drives the target through a sequence of keyframes stored
+// contiguously. It caches the index of the current segment, so that playing
+// the track forward or backward steps to the neighbouring segment in constant
+// time instead of searching the keyframes on every update.
+template <class Interval_, class Value_>
+class TrackAdaptor : public Adaptor<Interval_> {
+ public:
+  using Interval = Interval_;
+  using Value = Value_;
+
+ public:
+  TrackAdaptor(Value *target,
+               const std::vector<Keyframe<Value>>& keyframes,
+               Interpolation interpolation,
+               const Easing& easing,
+               const Interval& duration,
+               const Interval& delay,
+               const Callback& callback);
+
+  // Disallow copy semantics
+  TrackAdaptor(const TrackAdaptor&) = delete;
+  TrackAdaptor& operator=(const TrackAdaptor&) = delete;
+
+  // Move semantics
+  TrackAdaptor(TrackAdaptor&&) = default;
+
+  // Controlling the adaptor
+  using Adaptor<Interval>::update;
+
+  // Hash
+  std::size_t object_hash() const override;
+  std::size_t target_hash() const override;
+
+  // Batch update
+  typename Adaptor<Interval>::Batch batch() const override;
+
+  // Parameters
+  Value * target() const { return target_; }
+  const std::vector<Keyframe<Value>>& keyframes() const { return keyframes_; }
+  Interpolation interpolation() const { return interpolation_; }
+  std::size_t segment() const { return segment_; }
+
+ protected:
+  // Updates against the local unit time
+  void update(Unit unit) override;
+
+ private:
+  friend class Adaptor<Interval>;
+
+  Value evaluate(Unit position);
+
+  // Data members
+  Value *target_;
+  std::vector<Keyframe<Value>> keyframes_;
+  Interpolation interpolation_;
+  std::size_t segment_;
+};
+
+#pragma mark -
+
+template <class Interval, class Value>
+inline TrackAdaptor<Interval, Value>::TrackAdaptor(
+    Value *target,
+    const std::vector<Keyframe<Value>>& keyframes,
+    Interpolation interpolation,
+    const Easing& easing,
+    const Interval& duration,
+    const Interval& delay,
+    const Callback& callback)
+    : Adaptor<Interval>(easing, duration, delay, callback),
+      target_(target),
+      keyframes_(keyframes),
+      interpolation_(interpolation),
+      segment_() {
+  assert(!keyframes_.empty());
+  assert(std::is_sorted(keyframes_.begin(), keyframes_.end(),
+      [](const Keyframe<Value>& a, const Keyframe<Value>& b) {
+        return a.position < b.position;
+      }));
+}
+
+#pragma mark Updates against the local unit time
+
+template <class Interval, class Value>
+inline void TrackAdaptor<Interval, Value>::update(Unit unit) {
+  assert(target_);
+  if (unit < 0.0) {
+    // Keyframes have absolute values, leaving nothing to take on waking, but
+    // rewinding into the delay restores the value at the start of the track
+    if (this->begun()) {
+      *target_ = keyframes_.front().value;
+    }
+  } else if (this->duration().empty() || unit > 1.0) {
+    *target_ = evaluate(this->easing()(1.0));
+  } else {
+    *target_ = evaluate(this->easing()(unit));
+  }
+}
+
+template <class Interval, class Value>
+inline Value TrackAdaptor<Interval, Value>::evaluate(Unit position) {
+  const auto size = keyframes_.size();
+  if (size == 1 || position <= keyframes_.front().position) {
+    return keyframes_.front().value;
+  } else if (position >= keyframes_.back().position) {
+    return keyframes_.back().value;
+  }
+  // Step the cached segment towards the position, which takes a single step
+  // at most on sequential updates
+  while (position >= keyframes_[segment_ + 1].position) {
+    ++segment_;
+  }
+  while (position < keyframes_[segment_].position) {
+    --segment_;
+  }
+  const auto& from = keyframes_[segment_];
+  const auto& to = keyframes_[segment_ + 1];
+  const auto unit = from.easing(
+      (position - from.position) / (to.position - from.position));
+  const Transform<Value> lerp;
+  if (interpolation_ == Interpolation::LINEAR) {
+    return lerp(unit, from.value, to.value);
+  }
+  // Evaluate the uniform Catmull-Rom spline by repeated linear interpolation
+  // (Barry and Goldman), which only needs the transform of the value type.
+  // The end keyframes are repeated where the neighbours are missing.
+  const auto& before = keyframes_[segment_ ? segment_ - 1 : 0].value;
+  const auto& after = keyframes_[std::min(segment_ + 2, size - 1)].value;
+  const auto a1 = lerp(unit + 1.0, before, from.value);
+  const auto a2 = lerp(unit, from.value, to.value);
+  const auto a3 = lerp(unit - 1.0, to.value, after);
+  const auto b1 = lerp((unit + 1.0) / 2.0, a1, a2);
+  const auto b2 = lerp(unit / 2.0, a2, a3);
+  return lerp(unit, b1, b2);
+}
+
+#pragma mark Hash
+
+template <class Interval, class Value>
+inline std::size_t TrackAdaptor<Interval, Value>::object_hash() const {
+  return Hash(target_);
+}
+
+template <class Interval, class Value>
+inline std::size_t TrackAdaptor<Interval, Value>::target_hash() const {
+  return Hash(target_);
+}
+
+#pragma mark Batch update
+
+template <class Interval, class Value>
+inline typename Adaptor<Interval>::Batch
+    TrackAdaptor<Interval, Value>::batch() const {
+  if (typeid(*this) != typeid(TrackAdaptor)) {
+    return nullptr;
+  }
+  return &Adaptor<Interval>::template update<TrackAdaptor>;
+}
+
+}  // namespace tween
+}  // namespace takram
+
+#endif  // TAKRAM_TWEEN_TRACK_ADAPTOR_H_
@@ -28,15 +28,93 @@
 #ifndef TAKRAM_TWEEN_TRANSFORM_H_
 #define TAKRAM_TWEEN_TRANSFORM_H_
 
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "takram/easing/packed.h"
 #include "takram/tween/easing.h"
 #include "takram/tween/types.h"
 
 namespace takram {
 namespace tween {
 
+// Transform is the customization point for interpolating values of type T,
+// which can be specialized for user value types that do not support the
+// arithmetic of the default implementation.
+template <class T, class = void>
+struct Transform {
+  constexpr T operator()(Unit unit, const T& from, const T& to) const {
+    return from + (to - from) * unit;
+  }
+};
+
+// Fixed-size arrays are interpolated componentwise, in SIMD registers when
+// the components are floating point, so that a single tween and a single
+// easing evaluation drive a whole vector or color.
+template <class T, std::size_t N>
+struct Transform<std::array<T, N>,
+                 std::enable_if_t<std::is_floating_point<T>::value>> {
+  std::array<T, N> operator()(Unit unit,
+                              const std::array<T, N>& from,
+                              const std::array<T, N>& to) const;
+};
+
+template <class T, std::size_t N>
+struct Transform<std::array<T, N>,
+                 std::enable_if_t<!std::is_floating_point<T>::value>> {
+  std::array<T, N> operator()(Unit unit,
+                              const std::array<T, N>& from,
+                              const std::array<T, N>& to) const;
+};
+
 template <class T>
 T transform(const Easing& easing, Unit unit, const T& from, const T& to);
 
+#pragma mark -
+
+template <class T, std::size_t N>
+inline std::array<T, N> Transform<
+    std::array<T, N>, std::enable_if_t<std::is_floating_point<T>::value>>
+    ::operator()(Unit unit,
+                 const std::array<T, N>& from,
+                 const std::array<T, N>& to) const {
+  using Packed = easing::Packed<T>;
+  std::array<T, N> result;
+  const Packed packed_unit(static_cast<T>(unit));
+  std::size_t i = 0;
+  for (; i + Packed::width <= N; i += Packed::width) {
+    const auto a = Packed::load(from.data() + i);
+    const auto b = Packed::load(to.data() + i);
+    (a + (b - a) * packed_unit).store(result.data() + i);
+  }
+  for (; i < N; ++i) {
+    result[i] = from[i] + (to[i] - from[i]) * static_cast<T>(unit);
+  }
+  return result;
+}
+
+template <class T, std::size_t N>
+inline std::array<T, N> Transform<
+    std::array<T, N>, std::enable_if_t<!std::is_floating_point<T>::value>>
+    ::operator()(Unit unit,
+                 const std::array<T, N>& from,
+                 const std::array<T, N>& to) const {
+  std::array<T, N> result;
+  for (std::size_t i = 0; i < N; ++i) {
+    result[i] = Transform<T>()(unit, from[i], to[i]);
+  }
+  return result;
+}
+
+template <class T>
+inline T transform(const Easing& easing,
+                   Unit unit,
+                   const T& from,
+                   const T& to) {
+  return Transform<T>()(easing(unit), from, to);
+}
+
 }  // namespace tween
 }  // namespace takram
 
@@ -29,14 +29,19 @@
 #define TAKRAM_TWEEN_TWEEN_H_
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "takram/tween/accessor_adaptor.h"
 #include "takram/tween/adaptor.h"
 #include "takram/tween/interval.h"
+#include "takram/tween/keyframe.h"
 #include "takram/tween/pointer_adaptor.h"
+#include "takram/tween/track_adaptor.h"
 #include "takram/tween/types.h"
 
 namespace takram {
@@ -142,6 +147,39 @@ class Tween final {
         const Callback& callback,
         Timeline *timeline = nullptr);
 
+  // Construct with keyframes
+  template <class Value>
+  Tween(Value *target,
+        const std::vector<Keyframe<Value>>& keyframes,
+        Interpolation interpolation,
+        const Interval& duration,
+        Timeline *timeline = nullptr);
+  template <class Value>
+  Tween(Value *target,
+        const std::vector<Keyframe<Value>>& keyframes,
+        Interpolation interpolation,
+        const Interval& duration,
+        const Interval& delay,
+        Timeline *timeline = nullptr);
+  template <
+    class Value, class Callback,
+    EnableIfCallback<Callback> * = nullptr
+  >
+  Tween(Value *target,
+        const std::vector<Keyframe<Value>>& keyframes,
+        Interpolation interpolation,
+        const Interval& duration,
+        const Callback& callback,
+        Timeline *timeline = nullptr);
+  template <class Value>
+  Tween(Value *target,
+        const std::vector<Keyframe<Value>>& keyframes,
+        Interpolation interpolation,
+        const Interval& duration,
+        const Interval& delay,
+        const Callback& callback,
+        Timeline *timeline = nullptr);
+
   // Copy semantics
   Tween(const Tween&) = default;
   Tween& operator=(const Tween&) = default;
@@ -168,6 +206,10 @@ class Tween final {
   void set_delay(const Interval& value);
   const Callback& callback() const;
   void set_callback(const Callback& value);
+  std::size_t repeat() const;
+  void set_repeat(std::size_t value);
+  bool yoyo() const;
+  void set_yoyo(bool value);
 
   // Timeline
   Timeline * timeline() const;
@@ -179,6 +221,11 @@ class Tween final {
   // Conversion
   operator bool() const { return adaptor_ && timeline_; }
 
+ private:
+  // Allocates adaptors from the pool of the timeline if any
+  template <class T, class... Args>
+  static std::shared_ptr<T> make(Timeline *timeline, Args&&... args);
+
  private:
   std::shared_ptr<Adaptor<Interval>> adaptor_;
   Timeline *timeline_;
@@ -239,8 +286,8 @@ inline Tween<Interval>::Tween(Value *target,
                               const Interval& delay,
                               const Callback& callback,
                               Timeline *timeline)
-    : adaptor_(std::make_shared<PointerAdaptor<Interval, Value>>(
-          target, to, easing, duration, delay, callback)),
+    : adaptor_(make<PointerAdaptor<Interval, Value>>(
+          timeline, target, to, easing, duration, delay, callback)),
       timeline_(timeline) {
   assert(target);
 }
@@ -303,14 +350,80 @@ inline Tween<Interval>::Tween(Class *target,
                               const Interval& delay,
                               const Callback& callback,
                               Timeline *timeline)
-    : adaptor_(std::make_shared<AccessorAdaptor<
+    : adaptor_(make<AccessorAdaptor<
           Interval, Value, Class, Getter, Setter>>(
-              target, getter, setter, name, to,
+              timeline, target, getter, setter, name, to,
               easing, duration, delay, callback)),
       timeline_(timeline) {
   assert(target);
 }
 
+#pragma mark Construct with keyframes
+
+template <class Interval>
+template <class Value>
+inline Tween<Interval>::Tween(Value *target,
+                              const std::vector<Keyframe<Value>>& keyframes,
+                              Interpolation interpolation,
+                              const Interval& duration,
+                              Timeline *timeline)
+    : Tween(target, keyframes, interpolation,
+            duration, Interval(), nullptr, timeline) {}
+
+template <class Interval>
+template <class Value>
+inline Tween<Interval>::Tween(Value *target,
+                              const std::vector<Keyframe<Value>>& keyframes,
+                              Interpolation interpolation,
+                              const Interval& duration,
+                              const Interval& delay,
+                              Timeline *timeline)
+    : Tween(target, keyframes, interpolation,
+            duration, delay, nullptr, timeline) {}
+
+template <class Interval>
+template <
+  class Value, class Callback,
+  typename Tween<Interval>::template EnableIfCallback<Callback> *
+>
+inline Tween<Interval>::Tween(Value *target,
+                              const std::vector<Keyframe<Value>>& keyframes,
+                              Interpolation interpolation,
+                              const Interval& duration,
+                              const Callback& callback,
+                              Timeline *timeline)
+    : Tween(target, keyframes, interpolation,
+            duration, Interval(), callback, timeline) {}
+
+template <class Interval>
+template <class Value>
+inline Tween<Interval>::Tween(Value *target,
+                              const std::vector<Keyframe<Value>>& keyframes,
+                              Interpolation interpolation,
+                              const Interval& duration,
+                              const Interval& delay,
+                              const Callback& callback,
+                              Timeline *timeline)
+    : adaptor_(make<TrackAdaptor<Interval, Value>>(
+          timeline, target, keyframes, interpolation,
+          LinearEasing::In, duration, delay, callback)),
+      timeline_(timeline) {
+  assert(target);
+}
+
+#pragma mark Memory
+
+template <class Interval>
+template <class T, class... Args>
+inline std::shared_ptr<T> Tween<Interval>::make(Timeline *timeline,
+                                                Args&&... args) {
+  if (timeline) {
+    return std::allocate_shared<T>(timeline->allocator(),
+                                   std::forward<Args>(args)...);
+  }
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
 #pragma mark Comparison
 
 template <class Interval>
@@ -389,6 +502,30 @@ inline void Tween<Interval>::set_callback(const Callback& value) {
   return adaptor_->set_callback(value);
 }
 
+template <class Interval>
+inline std::size_t Tween<Interval>::repeat() const {
+  assert(adaptor_);
+  return adaptor_->repeat();
+}
+
+template <class Interval>
+inline void Tween<Interval>::set_repeat(std::size_t value) {
+  assert(adaptor_);
+  adaptor_->set_repeat(value);
+}
+
+template <class Interval>
+inline bool Tween<Interval>::yoyo() const {
+  assert(adaptor_);
+  return adaptor_->yoyo();
+}
+
+template <class Interval>
+inline void Tween<Interval>::set_yoyo(bool value) {
+  assert(adaptor_);
+  adaptor_->set_yoyo(value);
+}
+
 #pragma mark Timeline
 
 template <class Interval>
@@ -0,0 +1,104 @@
+//
+//  takram/tween/workers.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "takram/tween/workers.h"
+
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+
+namespace takram {
+namespace tween {
+
+Workers::Workers(std::size_t concurrency)
+    : function_(),
+      generation_(),
+      remaining_(),
+      terminated_(false) {
+  assert(concurrency);
+  for (std::size_t partition = 1; partition < concurrency; ++partition) {
+    threads_.emplace_back(&Workers::work, this, partition);
+  }
+}
+
+Workers::~Workers() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    terminated_ = true;
+  }
+  started_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void Workers::run(const Function& function) {
+  if (threads_.empty()) {
+    function(0);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    function_ = &function;
+    remaining_ = threads_.size();
+    ++generation_;
+  }
+  started_.notify_all();
+  function(0);
+  std::unique_lock<std::mutex> lock(mutex_);
+  finished_.wait(lock, [this]() { return !remaining_; });
+  function_ = nullptr;
+}
+
+void Workers::work(std::size_t partition) {
+  std::size_t generation = 0;
+  while (true) {
+    const Function *function;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      started_.wait(lock, [this, generation]() {
+        return terminated_ || generation_ != generation;
+      });
+      if (terminated_) {
+        return;
+      }
+      generation = generation_;
+      function = function_;
+    }
+    (*function)(partition);
+    bool finished;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      finished = !--remaining_;
+    }
+    if (finished) {
+      finished_.notify_one();
+    }
+  }
+}
+
+}  // namespace tween
+}  // namespace takram
@@ -0,0 +1,79 @@
+//
+//  takram/tween/workers.h
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#ifndef TAKRAM_TWEEN_WORKERS_H_
+#define TAKRAM_TWEEN_WORKERS_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace takram {
+namespace tween {
+
+// Workers is a fixed set of threads that run a function for each partition
+// in parallel, together with the calling thread.
+class Workers final {
+ public:
+  using Function = std::function<void(std::size_t partition)>;
+
+ public:
+  explicit Workers(std::size_t concurrency);
+  ~Workers();
+
+  // Disallow copy semantics
+  Workers(const Workers&) = delete;
+  Workers& operator=(const Workers&) = delete;
+
+  // Runs the function with every partition in [0, concurrency) and blocks
+  // until all of them have returned
+  void run(const Function& function);
+
+  // Attributes
+  std::size_t concurrency() const { return threads_.size() + 1; }
+
+ private:
+  void work(std::size_t partition);
+
+ private:
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable started_;
+  std::condition_variable finished_;
+  const Function *function_;
+  std::size_t generation_;
+  std::size_t remaining_;
+  bool terminated_;
+};
+
+}  // namespace tween
+}  // namespace takram
+
+#endif  // TAKRAM_TWEEN_WORKERS_H_
@@ -0,0 +1,116 @@
+//
+//  timeline_allocation_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "takram/tween/pointer_adaptor.h"
+#include "takram/tween/timeline.h"
+
+// This test replaces the global allocation functions to count allocations of
+// the whole program, and is built into its own executable so that the
+// replacement does not affect other tests.
+
+namespace {
+
+std::atomic<std::size_t> allocation_count(0);
+
+}  // namespace
+
+void * operator new(std::size_t size) {
+  ++allocation_count;
+  if (const auto pointer = std::malloc(size ? size : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void * operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+  operator delete(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+  operator delete(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+  operator delete(pointer);
+}
+
+namespace takram {
+namespace tween {
+
+template <class T>
+class TimelineAllocationTest : public ::testing::Test {};
+
+using Types = ::testing::Types<
+  Time,
+  Frame
+>;
+TYPED_TEST_CASE(TimelineAllocationTest, Types);
+
+TYPED_TEST(TimelineAllocationTest, NoAllocationInAdvance) {
+  Timeline<TypeParam> timeline;
+  std::vector<double> values(1000);
+  std::vector<float> delayed_values(1000);
+  for (auto& value : values) {
+    timeline.tween(&value, 1.0, LinearEasing::In, TypeParam(1000));
+  }
+  for (auto& value : delayed_values) {
+    timeline.tween(&value, 1.0f, QuadraticEasing::Out,
+                   TypeParam(1000), TypeParam(500));
+  }
+  for (int i = 0; i < 1000; ++i) {
+    timeline.timer(TypeParam(1000));
+  }
+  for (const auto concurrency : {1, 4}) {
+    timeline.set_concurrency(concurrency);
+    for (int i = 0; i < 3; ++i) {
+      timeline.advance();
+    }
+    const std::size_t count = allocation_count;
+    ASSERT_NE(count, 0u);
+    for (int i = 0; i < 100; ++i) {
+      timeline.advance();
+    }
+    ASSERT_EQ(allocation_count, count);
+  }
+}
+
+}  // namespace tween
+}  // namespace takram
@@ -0,0 +1,120 @@
+//
+//  bezier_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "takram/easing.h"
+
+namespace takram {
+namespace easing {
+
+namespace {
+
+double Evaluate(double t, double p1, double p2) {
+  const double s = 1.0 - t;
+  return 3.0 * s * s * t * p1 + 3.0 * s * t * t * p2 + t * t * t;
+}
+
+void ExpectOnCurve(double x1, double y1, double x2, double y2) {
+  const Bezier<double> bezier(x1, y1, x2, y2);
+  for (int i = 0; i <= 100; ++i) {
+    const double t = i / 100.0;
+    EXPECT_NEAR(bezier(Evaluate(t, x1, x2)), Evaluate(t, y1, y2), 1e-6);
+  }
+}
+
+}  // namespace
+
+TEST(BezierTest, Endpoints) {
+  const Bezier<double> bezier(0.25, 0.1, 0.25, 1.0);
+  ASSERT_NEAR(bezier(0.0), 0.0, 1e-9);
+  ASSERT_NEAR(bezier(1.0), 1.0, 1e-9);
+  ASSERT_NEAR(bezier(-1.0), 0.0, 1e-9);
+  ASSERT_NEAR(bezier(2.0), 1.0, 1e-9);
+}
+
+TEST(BezierTest, Linear) {
+  const Bezier<double> bezier(0.3, 0.3, 0.7, 0.7);
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_EQ(bezier(parameter), parameter);
+  }
+}
+
+TEST(BezierTest, Curve) {
+  ExpectOnCurve(0.25, 0.1, 0.25, 1.0);  // ease
+  ExpectOnCurve(0.42, 0.0, 1.0, 1.0);  // ease-in
+  ExpectOnCurve(0.0, 0.0, 0.58, 1.0);  // ease-out
+  ExpectOnCurve(0.68, -0.55, 0.265, 1.55);  // Overshooting
+  ExpectOnCurve(1.0, 0.0, 0.0, 1.0);  // Flat in the middle
+}
+
+TEST(BezierTest, Float) {
+  const Bezier<float> bezier(0.68f, -0.55f, 0.265f, 1.55f);
+  const Bezier<double> reference(0.68, -0.55, 0.265, 1.55);
+  for (int i = 0; i <= 100; ++i) {
+    const float parameter = i / 100.0f;
+    ASSERT_NEAR(bezier(parameter), reference(parameter), 1e-5);
+  }
+  ASSERT_EQ(bezier(0.0f), 0.0f);
+  ASSERT_NEAR(bezier(1.0f), 1.0f, 1e-6f);
+}
+
+TEST(BezierTest, Batch) {
+  const Bezier<double> bezier(0.42, 0.0, 0.58, 1.0);
+  const auto easing = bezier.easing();
+  std::vector<double> parameters(37);
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<double>(i) / (parameters.size() - 1);
+  }
+  std::vector<double> results(parameters.size());
+  easing(parameters.data(), results.data(), parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    ASSERT_EQ(results[i], bezier(parameters[i]));
+    ASSERT_EQ(easing(parameters[i]), bezier(parameters[i]));
+  }
+}
+
+TEST(BezierTest, Lifetime) {
+  const Bezier<double> bezier(0.25, 0.1, 0.25, 1.0);
+  Easing<double> easing;
+  {
+    const Bezier<double> copy(bezier);
+    easing = copy.easing();
+  }
+  // The handle keeps the curve alive after the bezier is destroyed
+  ASSERT_EQ(easing, bezier.easing());
+  ASSERT_EQ(easing(0.3), bezier(0.3));
+  const Easing<double> temporary =
+      Bezier<double>(0.42, 0.0, 0.58, 1.0).easing();
+  ASSERT_NEAR(temporary(0.5), 0.5, 1e-9);
+}
+
+}  // namespace easing
+}  // namespace takram
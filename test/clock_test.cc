@@ -25,6 +25,8 @@
 //
 
 #include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -34,10 +36,21 @@
 namespace takram {
 namespace tween {
 
+namespace {
+
+std::int64_t fake_nanoseconds;
+
+std::int64_t FakeTimeSource() {
+  return fake_nanoseconds;
+}
+
+}  // namespace
+
 TEST(ClockTest, DefaultConstructible) {
   Clock<Time> time_clock;
   Clock<Frame> frame_clock;
-  ASSERT_NE(time_clock.now(), Time());
+  ASSERT_GE(time_clock.now(), Time());
+  ASSERT_LT(time_clock.now(), Time(1.0));
   ASSERT_NE(frame_clock.now(), Frame());
 }
 
@@ -74,5 +87,126 @@ TEST(ClockTest, Advance) {
   ASSERT_EQ((frame_clock.now() - frame).count(), 1);
 }
 
+TEST(ClockTest, Pause) {
+  Clock<Frame> clock;
+  const auto frame = clock.now();
+  clock.pause();
+  ASSERT_TRUE(clock.paused());
+  clock.advance();
+  clock.advance();
+  ASSERT_EQ(clock.now(), frame);
+  clock.resume();
+  ASSERT_FALSE(clock.paused());
+  clock.advance();
+  ASSERT_EQ(clock.now(), frame + Frame(1));
+}
+
+TEST(ClockTest, Rate) {
+  Clock<Frame> clock;
+  const auto frame = clock.now();
+  clock.set_rate(0.5);
+  ASSERT_EQ(clock.rate(), 0.5);
+  const FrameValue expected[] = {0, 0, 1, 1, 2, 2};
+  for (const auto count : expected) {
+    ASSERT_EQ((clock.now() - frame).count(), count);
+    clock.advance();
+  }
+  clock.set_rate(-2.0);
+  clock.advance();
+  ASSERT_EQ((clock.now() - frame).count(), 1);
+}
+
+TEST(ClockTest, Seek) {
+  Clock<Frame> clock;
+  clock.seek(Frame(100));
+  ASSERT_EQ(clock.now(), Frame(100));
+  clock.advance();
+  ASSERT_EQ(clock.now(), Frame(101));
+  Clock<Time> time_clock;
+  time_clock.seek(Time(10.0));
+  ASSERT_EQ(time_clock.now(), Time(10.0));
+  time_clock.advance();
+  ASSERT_GE(time_clock.now(), Time(10.0));
+  ASSERT_LT(time_clock.now(), Time(11.0));
+}
+
+TEST(ClockTest, FixedStep) {
+  Clock<Frame> clock;
+  const auto frame = clock.now();
+  clock.set_fixed_step(Frame(3));
+  ASSERT_EQ(clock.fixed_step(), Frame(3));
+  clock.advance();
+  ASSERT_EQ(clock.now(), frame);
+  ASSERT_DOUBLE_EQ(clock.alpha(), 1.0 / 3.0);
+  clock.advance();
+  ASSERT_EQ(clock.now(), frame);
+  ASSERT_DOUBLE_EQ(clock.alpha(), 2.0 / 3.0);
+  clock.advance();
+  ASSERT_EQ(clock.now(), frame + Frame(3));
+  ASSERT_EQ(clock.alpha(), 0.0);
+
+  // Hitches beyond the maximum steps are dropped, keeping the fraction
+  clock.set_max_steps(1);
+  clock.set_rate(10.0);
+  clock.advance();
+  ASSERT_EQ(clock.now(), frame + Frame(6));
+  ASSERT_DOUBLE_EQ(clock.alpha(), 1.0 / 3.0);
+
+  Clock<Time> time_clock;
+  const auto time = time_clock.now();
+  const Time step(1.0 / 64.0);
+  time_clock.set_fixed_step(step);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  time_clock.advance();
+  const auto steps = (time_clock.now() - time) / step;
+  ASSERT_GE(steps, 3.0);
+  ASSERT_EQ(steps, std::floor(steps));
+  ASSERT_GE(time_clock.alpha(), 0.0);
+  ASSERT_LT(time_clock.alpha(), 1.0);
+}
+
+TEST(ClockTest, Source) {
+  Clock<Time> clock;
+  ASSERT_EQ(clock.source(), &SteadyTimeSource);
+
+  // Replacing the source keeps the time
+  fake_nanoseconds = std::int64_t(30) * 24 * 60 * 60 * 1000000000;
+  const auto time = clock.advance();
+  clock.set_source(&FakeTimeSource);
+  ASSERT_EQ(clock.source(), &FakeTimeSource);
+  ASSERT_EQ(clock.advance(), time);
+
+  // Every nanosecond counts regardless of the uptime of the source
+  for (int i = 0; i < 1000; ++i) {
+    ++fake_nanoseconds;
+    clock.advance();
+  }
+  ASSERT_DOUBLE_EQ((clock.now() - time).count(), 1e-6);
+
+  clock.set_source(&CoarseTimeSource);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  clock.advance();
+  ASSERT_GT(clock.now() - time, Time(0.02));
+}
+
+TEST(ClockTest, AdvanceToTime) {
+  Clock<Frame> shared;
+  Clock<Frame> clock;
+  const auto frame = clock.now();
+  shared.advance();
+  shared.advance();
+  ASSERT_EQ(clock.advance(shared.now()), shared.now());
+  ASSERT_EQ(clock.now(), shared.now());
+
+  // The next read continues from the time given
+  ASSERT_EQ(clock.advance(), shared.now());
+  ASSERT_EQ(clock.advance(), shared.now() + Frame(1));
+
+  clock.pause();
+  ASSERT_EQ(clock.advance(frame), shared.now() + Frame(1));
+  clock.resume();
+  ASSERT_EQ(clock.advance(frame), frame);
+}
+
 }  // namespace tween
 }  // namespace takram
@@ -0,0 +1,126 @@
+//
+//  composition_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include "takram/easing.h"
+
+namespace takram {
+namespace easing {
+
+namespace {
+
+constexpr auto in = QuadraticEasing<double>::In;
+constexpr auto out = QuadraticEasing<double>::Out;
+
+// Evaluated at compile time
+constexpr double table[] = {
+  CubicEasing<double>::InOut(0.0),
+  CubicEasing<double>::InOut(0.25),
+  CubicEasing<double>::InOut(0.5),
+  CubicEasing<double>::InOut(0.75),
+  CubicEasing<double>::InOut(1.0),
+};
+
+static_assert(table[0] == 0.0, "");
+static_assert(table[1] == 0.0625, "");
+static_assert(table[2] == 0.5, "");
+static_assert(table[3] == 0.9375, "");
+static_assert(table[4] == 1.0, "");
+static_assert(BounceEasing<double>::Out(1.0) == 1.0, "");
+static_assert(sequence(in, out)(0.25) == 0.125, "");
+static_assert(clamp(scale(BackEasing<double>::In, 2.0))(0.1) == 0.0, "");
+
+}  // namespace
+
+TEST(CompositionTest, Sequence) {
+  const auto easing = sequence(in, out);
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_DOUBLE_EQ(easing(parameter),
+                     QuadraticEasing<double>::InOut(parameter));
+  }
+  const auto uneven = sequence(in, LinearEasing<double>::In, 0.25);
+  ASSERT_EQ(uneven(0.0), 0.0);
+  ASSERT_EQ(uneven(0.125), 0.0625);
+  ASSERT_EQ(uneven(0.25), 0.25);
+  ASSERT_EQ(uneven(0.625), 0.625);
+  ASSERT_EQ(uneven(1.0), 1.0);
+}
+
+TEST(CompositionTest, Blend) {
+  const auto easing = blend(in, out, 0.25);
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_DOUBLE_EQ(easing(parameter), 0.75 * in(parameter) +
+                                        0.25 * out(parameter));
+  }
+}
+
+TEST(CompositionTest, Mirror) {
+  const auto easing = mirror(in);
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_EQ(easing(parameter), out(parameter));
+  }
+}
+
+TEST(CompositionTest, ScaleAndClamp) {
+  const auto scaled = scale(LinearEasing<double>::In, 2.0);
+  ASSERT_EQ(scaled(0.25), 0.5);
+  ASSERT_EQ(scaled(0.5), 1.0);
+  ASSERT_EQ(scaled(0.75), 1.0);
+  const auto clamped = clamp(BackEasing<double>::In);
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_GE(clamped(parameter), 0.0);
+    ASSERT_LE(clamped(parameter), 1.0);
+  }
+}
+
+TEST(CompositionTest, Handle) {
+  const Easing<double> easing = sequence(in, mirror(in));
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_EQ(easing(parameter), sequence(in, out)(parameter));
+  }
+}
+
+TEST(CompositionTest, NestedHandle) {
+  constexpr auto nested = sequence(sequence(in, QuadraticEasing<double>::Out),
+                                   CubicEasing<double>::Out);
+  static_assert(nested(0.0) == 0.0 && nested(1.0) == 1.0, "");
+  const Easing<double> easing = nested;
+  const Easing<double> copy = easing;
+  ASSERT_EQ(copy, easing);
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_EQ(easing(parameter), nested(parameter));
+  }
+}
+
+}  // namespace easing
+}  // namespace takram
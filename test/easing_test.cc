@@ -0,0 +1,158 @@
+//
+//  easing_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "takram/easing.h"
+
+namespace takram {
+namespace easing {
+
+namespace {
+
+double Square(double parameter) {
+  return parameter * parameter;
+}
+
+}  // namespace
+
+TEST(EasingTest, NothrowCopyable) {
+  ASSERT_TRUE(std::is_nothrow_copy_constructible<Easing<double>>::value);
+  ASSERT_TRUE(std::is_nothrow_move_constructible<Easing<float>>::value);
+}
+
+TEST(EasingTest, Empty) {
+  Easing<double> easing;
+  ASSERT_FALSE(easing);
+  ASSERT_EQ(easing, Easing<double>());
+}
+
+TEST(EasingTest, Preset) {
+  const Easing<double> in = CubicEasing<double>::In;
+  const Easing<double> out = CubicEasing<double>::Out;
+  const Easing<double> in_out = CubicEasing<double>::InOut;
+  ASSERT_TRUE(in);
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_EQ(in(parameter), CubicEasing<double>::In(parameter));
+    ASSERT_EQ(out(parameter), CubicEasing<double>::Out(parameter));
+    ASSERT_EQ(in_out(parameter), CubicEasing<double>::InOut(parameter));
+  }
+}
+
+TEST(EasingTest, Callable) {
+  const double exponent = 2.0;
+  const Easing<double> lambda = [exponent](double parameter) {
+    return std::pow(parameter, exponent);
+  };
+  const Easing<double> function = &Square;
+  const Easing<double> reference = Square;
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_DOUBLE_EQ(lambda(parameter), parameter * parameter);
+    ASSERT_EQ(function(parameter), parameter * parameter);
+    ASSERT_EQ(reference(parameter), parameter * parameter);
+  }
+}
+
+TEST(EasingTest, SharedCallable) {
+  const auto exponent = std::make_shared<double>(2.0);
+  Easing<double> easing = [exponent](double parameter) {
+    return std::pow(parameter, *exponent);
+  };
+  ASSERT_EQ(exponent.use_count(), 2);
+  {
+    // Copies share the callable instead of copying it
+    const Easing<double> copy = easing;
+    ASSERT_EQ(copy, easing);
+    ASSERT_EQ(exponent.use_count(), 2);
+    easing = CubicEasing<double>::In;
+    ASSERT_EQ(exponent.use_count(), 2);
+    ASSERT_DOUBLE_EQ(copy(0.5), 0.25);
+  }
+  ASSERT_EQ(exponent.use_count(), 1);
+
+  const std::function<double(double)> function = &Square;
+  const Easing<double> wrapped = function;
+  Easing<double> moved = wrapped;
+  const Easing<double> other = std::move(moved);
+  ASSERT_EQ(other, wrapped);
+  ASSERT_FALSE(moved);
+  ASSERT_EQ(moved, Easing<double>());
+  moved = Easing<double>(CubicEasing<double>::In);
+  ASSERT_TRUE(moved);
+  ASSERT_NE(Easing<double>(function), wrapped);
+  for (int i = 0; i <= 10; ++i) {
+    const double parameter = i / 10.0;
+    ASSERT_EQ(wrapped(parameter), parameter * parameter);
+    ASSERT_EQ(other(parameter), parameter * parameter);
+  }
+}
+
+TEST(EasingTest, Comparison) {
+  const Easing<double> easing1 = CubicEasing<double>::In;
+  const Easing<double> easing2 = CubicEasing<double>::In;
+  const Easing<double> easing3 = CubicEasing<double>::Out;
+  const Easing<double> easing4 = QuadraticEasing<double>::In;
+  ASSERT_EQ(easing1, easing2);
+  ASSERT_NE(easing1, easing3);
+  ASSERT_NE(easing1, easing4);
+  const auto scale = [](double factor) {
+    return Easing<double>([factor](double parameter) {
+      return parameter * factor;
+    });
+  };
+  ASSERT_EQ(scale(1.0), scale(1.0));
+  ASSERT_NE(scale(1.0), scale(2.0));
+}
+
+TEST(EasingTest, Batch) {
+  const Easing<double> preset = ElasticEasing<double>::InOut;
+  const Easing<double> function = &Square;
+  std::vector<double> parameters(37);
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<double>(i) / (parameters.size() - 1);
+  }
+  std::vector<double> results(parameters.size());
+  preset(parameters.data(), results.data(), parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    ASSERT_EQ(results[i], preset(parameters[i]));
+  }
+  function(parameters.data(), results.data(), parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    ASSERT_EQ(results[i], function(parameters[i]));
+  }
+}
+
+}  // namespace easing
+}  // namespace takram
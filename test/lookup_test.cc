@@ -0,0 +1,102 @@
+//
+//  lookup_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "takram/easing.h"
+
+namespace takram {
+namespace easing {
+
+namespace {
+
+template <class Function>
+double MaxError(const Lookup<double>& lookup, Function function) {
+  double error = 0.0;
+  for (std::size_t i = 0; i <= 1000; ++i) {
+    const auto parameter = i / 1000.0;
+    error = std::max(error, std::abs(lookup(parameter) - function(parameter)));
+  }
+  return error;
+}
+
+}  // namespace
+
+TEST(LookupTest, Linear) {
+  const Lookup<double> lookup(SinusoidalEasing<double>::InOut, 256);
+  ASSERT_EQ(lookup.resolution(), 256);
+  ASSERT_EQ(lookup(0.0), 0.0);
+  ASSERT_EQ(lookup(1.0), 1.0);
+  ASSERT_EQ(lookup(-1.0), 0.0);
+  ASSERT_EQ(lookup(2.0), 1.0);
+  ASSERT_LT(MaxError(lookup, SinusoidalEasing<double>::InOut), 1e-4);
+}
+
+TEST(LookupTest, Cubic) {
+  using Interpolation = Lookup<double>::Interpolation;
+  const Lookup<double> linear(ElasticEasing<double>::Out, 256);
+  const Lookup<double> cubic(ElasticEasing<double>::Out, 256,
+                             Interpolation::CUBIC);
+  ASSERT_EQ(cubic.interpolation(), Interpolation::CUBIC);
+  ASSERT_LT(MaxError(cubic, ElasticEasing<double>::Out),
+            MaxError(linear, ElasticEasing<double>::Out));
+}
+
+TEST(LookupTest, Handle) {
+  const Lookup<double> lookup(CircularEasing<double>::In, 1024);
+  const auto easing = lookup.easing();
+  ASSERT_EQ(easing, lookup.easing());
+  std::vector<double> parameters(37);
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<double>(i) / (parameters.size() - 1);
+  }
+  std::vector<double> results(parameters.size());
+  easing(parameters.data(), results.data(), parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    ASSERT_EQ(results[i], lookup(parameters[i]));
+    ASSERT_EQ(easing(parameters[i]), lookup(parameters[i]));
+  }
+}
+
+TEST(LookupTest, Lifetime) {
+  Easing<double> easing;
+  {
+    const Lookup<double> lookup(CubicEasing<double>::In, 1024);
+    easing = lookup.easing();
+  }
+  // The handle keeps the table alive after the lookup is destroyed
+  ASSERT_NEAR(easing(0.5), CubicEasing<double>::In(0.5), 1e-4);
+  const Easing<double> temporary =
+      Lookup<double>(QuadraticEasing<double>::Out, 256).easing();
+  ASSERT_NEAR(temporary(0.5), QuadraticEasing<double>::Out(0.5), 1e-4);
+}
+
+}  // namespace easing
+}  // namespace takram
@@ -0,0 +1,93 @@
+//
+//  packed_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "takram/easing.h"
+
+namespace takram {
+namespace easing {
+
+namespace {
+
+template <class T, class Easing>
+void ExpectBatchEqualsScalar(Easing easing) {
+  std::vector<T> parameters(37);
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = static_cast<T>(i) / (parameters.size() - 1);
+  }
+  std::vector<T> results(parameters.size());
+  easing(parameters.data(), results.data(), parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i) {
+    EXPECT_NEAR(results[i], easing(parameters[i]), 1e-5);
+  }
+}
+
+template <class T, class Group>
+void ExpectBatchEqualsScalar() {
+  ExpectBatchEqualsScalar<T>(Group::In);
+  ExpectBatchEqualsScalar<T>(Group::Out);
+  ExpectBatchEqualsScalar<T>(Group::InOut);
+}
+
+}  // namespace
+
+template <class T>
+class PackedTest : public ::testing::Test {};
+
+using Types = ::testing::Types<float, double, long double>;
+TYPED_TEST_CASE(PackedTest, Types);
+
+TYPED_TEST(PackedTest, Packable) {
+  using T = TypeParam;
+  constexpr const bool wide = Packed<T>::width > 1;
+  ASSERT_EQ((IsPackable<preset::Cubic<T>, T>::value), wide);
+  ASSERT_EQ((IsPackable<preset::Back<T>, T>::value), wide);
+  ASSERT_EQ((IsPackable<preset::Circular<T>, T>::value), wide);
+  ASSERT_FALSE((IsPackable<preset::Elastic<T>, T>::value));
+  ASSERT_FALSE((IsPackable<preset::Bounce<T>, T>::value));
+}
+
+TYPED_TEST(PackedTest, Evaluate) {
+  using T = TypeParam;
+  ExpectBatchEqualsScalar<T, BackEasing<T>>();
+  ExpectBatchEqualsScalar<T, BounceEasing<T>>();
+  ExpectBatchEqualsScalar<T, CircularEasing<T>>();
+  ExpectBatchEqualsScalar<T, CubicEasing<T>>();
+  ExpectBatchEqualsScalar<T, ElasticEasing<T>>();
+  ExpectBatchEqualsScalar<T, ExponentialEasing<T>>();
+  ExpectBatchEqualsScalar<T, LinearEasing<T>>();
+  ExpectBatchEqualsScalar<T, QuadraticEasing<T>>();
+  ExpectBatchEqualsScalar<T, QuarticEasing<T>>();
+  ExpectBatchEqualsScalar<T, QuinticEasing<T>>();
+  ExpectBatchEqualsScalar<T, SinusoidalEasing<T>>();
+}
+
+}  // namespace easing
+}  // namespace takram
@@ -0,0 +1,119 @@
+//
+//  parallel_adaptor_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "takram/easing.h"
+#include "takram/tween/interval.h"
+#include "takram/tween/parallel_adaptor.h"
+#include "takram/tween/pointer_adaptor.h"
+
+namespace takram {
+namespace tween {
+
+namespace {
+
+std::shared_ptr<Adaptor<Frame>> Step(double *value,
+                                     double to,
+                                     const Frame& duration,
+                                     const Frame& delay = Frame()) {
+  return std::make_shared<PointerAdaptor<Frame, double>>(
+      value, to, LinearEasing::In, duration, delay, nullptr);
+}
+
+}  // namespace
+
+TEST(ParallelAdaptorTest, Duration) {
+  double value1 = 0.0;
+  double value2 = 0.0;
+  const ParallelAdaptor<Frame> adaptor({
+    Step(&value1, 1.0, Frame(4)),
+    Step(&value2, 2.0, Frame(2), Frame(3)),
+  });
+  ASSERT_EQ(adaptor.duration(), Frame(5));
+  ASSERT_EQ(adaptor.children().size(), 2);
+  ASSERT_EQ(adaptor.object_hash(), Hash(&adaptor));
+  ASSERT_EQ(adaptor.target_hash(), Hash(&adaptor));
+}
+
+TEST(ParallelAdaptorTest, Update) {
+  double value1 = 0.0;
+  double value2 = 0.0;
+  ParallelAdaptor<Frame> adaptor({
+    Step(&value1, 4.0, Frame(4)),
+    Step(&value2, 2.0, Frame(2), Frame(1)),
+  });
+  adaptor.start(Frame(0));
+  const double expected1[] = {0.0, 1.0, 2.0, 3.0, 4.0};
+  const double expected2[] = {0.0, 0.0, 1.0, 2.0, 2.0};
+  for (int i = 0; i <= 4; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_EQ(value1, expected1[i]);
+    ASSERT_EQ(value2, expected2[i]);
+  }
+  ASSERT_TRUE(adaptor.finished());
+  for (const auto& child : adaptor.children()) {
+    ASSERT_TRUE(child->finished());
+  }
+}
+
+TEST(ParallelAdaptorTest, Easing) {
+  double value = 0.0;
+  ParallelAdaptor<Frame> adaptor({
+    Step(&value, 1.0, Frame(2)),
+  }, QuadraticEasing::In);
+  adaptor.start(Frame(0));
+  adaptor.update(Frame(1));
+  ASSERT_EQ(value, 0.25);
+  adaptor.update(Frame(2));
+  ASSERT_EQ(value, 1.0);
+}
+
+TEST(ParallelAdaptorTest, Repeat) {
+  double value1 = 0.0;
+  double value2 = 0.0;
+  ParallelAdaptor<Frame> adaptor({
+    Step(&value1, 1.0, Frame(2)),
+    Step(&value2, 1.0, Frame(4)),
+  });
+  adaptor.set_repeat(1);
+  adaptor.start(Frame(0));
+  const double expected1[] = {0.0, 0.5, 1.0, 1.0, 0.0, 0.5, 1.0, 1.0, 1.0};
+  const double expected2[] = {
+    0.0, 0.25, 0.5, 0.75, 0.0, 0.25, 0.5, 0.75, 1.0
+  };
+  for (int i = 0; i <= 8; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_EQ(value1, expected1[i]);
+    ASSERT_EQ(value2, expected2[i]);
+  }
+  ASSERT_TRUE(adaptor.finished());
+}
+
+}  // namespace tween
+}  // namespace takram
@@ -24,6 +24,7 @@
 //  DEALINGS IN THE SOFTWARE.
 //
 
+#include <memory>
 #include <thread>
 #include <utility>
 
@@ -33,10 +34,32 @@
 #include "takram/tween/clock.h"
 #include "takram/tween/interval.h"
 #include "takram/tween/pointer_adaptor.h"
+#include "takram/tween/timeline.h"
 
 namespace takram {
 namespace tween {
 
+namespace {
+
+class CountingAdaptor : public PointerAdaptor<Frame, double> {
+ public:
+  CountingAdaptor(double *target, int *count)
+      : PointerAdaptor<Frame, double>(
+            target, 1.0, LinearEasing::In, Frame(5), Frame(), nullptr),
+        count_(count) {}
+
+ protected:
+  void update(Unit unit) override {
+    ++*count_;
+    PointerAdaptor<Frame, double>::update(unit);
+  }
+
+ private:
+  int *count_;
+};
+
+}  // namespace
+
 template <class T>
 class PointerAdaptorTest : public ::testing::Test {};
 
@@ -47,10 +70,10 @@ using Types = ::testing::Types<
 TYPED_TEST_CASE(PointerAdaptorTest, Types);
 
 TYPED_TEST(PointerAdaptorTest, Constructible) {
-  double from1;
-  double from2;
-  double to1;
-  double to2;
+  double from1 = 1.0;
+  double from2 = 2.0;
+  double to1 = 3.0;
+  double to2 = 4.0;
   const auto adaptor1 = PointerAdaptor<TypeParam, double>(
       &from1, to1, LinearEasing::In, TypeParam(), TypeParam(), nullptr);
   const auto adaptor2 = PointerAdaptor<TypeParam, double>(
@@ -64,8 +87,8 @@ TYPED_TEST(PointerAdaptorTest, Constructible) {
 }
 
 TYPED_TEST(PointerAdaptorTest, MoveConstructible) {
-  double from;
-  double to;
+  double from = 1.0;
+  double to = 2.0;
   auto adaptor1 = PointerAdaptor<TypeParam, double>(
       &from, to, LinearEasing::In, TypeParam(), TypeParam(), nullptr);
   const auto adaptor2 = std::move(adaptor1);
@@ -214,5 +237,72 @@ TEST(PointerAdaptorTest, FrameDelay) {
   ASSERT_NE(value, from);
 }
 
+TEST(PointerAdaptorTest, Repeat) {
+  double value = 0.0;
+  auto adaptor = PointerAdaptor<Frame, double>(
+      &value, 4.0, LinearEasing::In, Frame(4), Frame(), nullptr);
+  adaptor.set_repeat(2);
+  ASSERT_EQ(adaptor.span(), Frame(12));
+  adaptor.start(Frame(0));
+  ASSERT_EQ(adaptor.deadline(), Frame(12));
+  for (int i = 0; i < 12; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_EQ(value, i % 4);
+    ASSERT_TRUE(adaptor.running());
+  }
+  adaptor.update(Frame(12));
+  ASSERT_EQ(value, 4.0);
+  ASSERT_TRUE(adaptor.finished());
+}
+
+TEST(PointerAdaptorTest, Yoyo) {
+  double value = 0.0;
+  auto adaptor = PointerAdaptor<Frame, double>(
+      &value, 4.0, LinearEasing::In, Frame(4), Frame(), nullptr);
+  adaptor.set_repeat(1);
+  adaptor.set_yoyo(true);
+  adaptor.start(Frame(0));
+  const double expected[] = {0, 1, 2, 3, 4, 3, 2, 1, 0};
+  for (int i = 0; i <= 8; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_EQ(value, expected[i]);
+  }
+  ASSERT_TRUE(adaptor.finished());
+}
+
+TEST(PointerAdaptorTest, RepeatInfinitely) {
+  double value = 0.0;
+  auto adaptor = PointerAdaptor<Frame, double>(
+      &value, 4.0, LinearEasing::In, Frame(4), Frame(), nullptr);
+  adaptor.set_repeat(PointerAdaptor<Frame, double>::infinite);
+  adaptor.set_yoyo(true);
+  adaptor.start(Frame(0));
+  adaptor.update(Frame(4000001));
+  ASSERT_EQ(value, 1.0);
+  adaptor.update(Frame(4000005));
+  ASSERT_EQ(value, 3.0);
+  ASSERT_TRUE(adaptor.running());
+  ASSERT_FALSE(adaptor.finished());
+}
+
+TEST(PointerAdaptorTest, Subclass) {
+  Timeline<Frame> timeline;
+  double value = 0.0;
+  int count = 0;
+  const auto adaptor = std::make_shared<CountingAdaptor>(&value, &count);
+  ASSERT_FALSE(adaptor->batch());
+  const auto tween = timeline.tween(adaptor);
+  for (int i = 0; i < 5; ++i) {
+    timeline.advance();
+  }
+  // The timeline calls the override instead of the batch update
+  ASSERT_GE(count, 5);
+  ASSERT_EQ(value, 1.0);
+  ASSERT_TRUE(tween.finished());
+  const auto base = PointerAdaptor<Frame, double>(
+      &value, 0.0, LinearEasing::In, Frame(1), Frame(), nullptr);
+  ASSERT_TRUE(base.batch());
+}
+
 }  // namespace tween
 }  // namespace takram
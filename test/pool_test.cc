@@ -0,0 +1,105 @@
+//
+//  pool_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "takram/tween/pool.h"
+#include "takram/tween/timeline.h"
+
+namespace takram {
+namespace tween {
+
+TEST(PoolTest, Recycles) {
+  Pool pool;
+  const auto first = pool.allocate(24);
+  pool.deallocate(first, 24);
+  ASSERT_EQ(pool.allocate(24), first);
+  pool.deallocate(first, 24);
+  const auto large = pool.allocate(Pool::max_size + 1);
+  ASSERT_NE(large, nullptr);
+  pool.deallocate(large, Pool::max_size + 1);
+}
+
+TEST(PoolTest, Distinct) {
+  Pool pool;
+  std::set<void *> pointers;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    const auto pointer = pool.allocate(48);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % Pool::alignment, 0);
+    ASSERT_TRUE(pointers.insert(pointer).second);
+  }
+  for (auto pointer : pointers) {
+    pool.deallocate(pointer, 48);
+  }
+}
+
+TEST(PoolTest, Allocator) {
+  const auto pool = std::make_shared<Pool>();
+  PoolAllocator<int> allocator(pool);
+  std::vector<int, PoolAllocator<int>> vector(allocator);
+  for (int i = 0; i < 100; ++i) {
+    vector.emplace_back(i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(vector[i], i);
+  }
+  ASSERT_EQ(PoolAllocator<double>(allocator), allocator);
+  ASSERT_NE(PoolAllocator<int>(std::make_shared<Pool>()), allocator);
+}
+
+template <class T>
+class PoolTimelineTest : public ::testing::Test {};
+
+using Types = ::testing::Types<
+  Time,
+  Frame
+>;
+TYPED_TEST_CASE(PoolTimelineTest, Types);
+
+TYPED_TEST(PoolTimelineTest, OutlivesTimeline) {
+  double value{};
+  std::shared_ptr<Adaptor<TypeParam>> adaptor;
+  TypeParam now;
+  {
+    Timeline<TypeParam> timeline;
+    adaptor = timeline.tween(&value, 1.0, LinearEasing::In,
+                             TypeParam(1)).adaptor();
+    ASSERT_EQ(timeline.contains(&value), true);
+    now = timeline.now();
+  }
+  // The adaptor keeps the pool of the destroyed timeline alive
+  adaptor->update(now + TypeParam(2));
+  ASSERT_EQ(value, 1.0);
+}
+
+}  // namespace tween
+}  // namespace takram
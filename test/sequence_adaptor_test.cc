@@ -0,0 +1,226 @@
+//
+//  sequence_adaptor_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "takram/easing.h"
+#include "takram/tween/interval.h"
+#include "takram/tween/pointer_adaptor.h"
+#include "takram/tween/sequence_adaptor.h"
+#include "takram/tween/timeline.h"
+
+namespace takram {
+namespace tween {
+
+namespace {
+
+std::shared_ptr<Adaptor<Frame>> Step(double *value,
+                                     double to,
+                                     const Frame& duration,
+                                     const Frame& delay = Frame()) {
+  return std::make_shared<PointerAdaptor<Frame, double>>(
+      value, to, LinearEasing::In, duration, delay, nullptr);
+}
+
+}  // namespace
+
+TEST(SequenceAdaptorTest, Duration) {
+  double value = 0.0;
+  const SequenceAdaptor<Frame> adaptor({
+    Step(&value, 1.0, Frame(2)),
+    Step(&value, 2.0, Frame(3), Frame(1)),
+  });
+  ASSERT_EQ(adaptor.duration(), Frame(6));
+  ASSERT_EQ(adaptor.children().size(), 2);
+  ASSERT_EQ(adaptor.object_hash(), Hash(&adaptor));
+  ASSERT_EQ(adaptor.target_hash(), Hash(&adaptor));
+}
+
+TEST(SequenceAdaptorTest, Update) {
+  double value = 0.0;
+  SequenceAdaptor<Frame> adaptor({
+    Step(&value, 2.0, Frame(2)),
+    Step(&value, 0.0, Frame(2)),
+    Step(&value, 3.0, Frame(1), Frame(1)),
+  });
+  adaptor.start(Frame(0));
+  // The next child starts on the update the previous one finishes, from the
+  // value the previous one left
+  const double expected[] = {0.0, 1.0, 2.0, 1.0, 0.0, 0.0, 3.0};
+  for (int i = 0; i <= 6; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_EQ(value, expected[i]);
+  }
+  ASSERT_EQ(adaptor.current(), 3);
+  ASSERT_TRUE(adaptor.finished());
+  for (const auto& child : adaptor.children()) {
+    ASSERT_TRUE(child->finished());
+  }
+}
+
+TEST(SequenceAdaptorTest, Skip) {
+  double value = 0.0;
+  SequenceAdaptor<Frame> adaptor({
+    Step(&value, 2.0, Frame(2)),
+    Step(&value, 5.0, Frame(2)),
+  });
+  adaptor.start(Frame(0));
+  adaptor.update(Frame(100));
+  ASSERT_EQ(value, 5.0);
+  ASSERT_TRUE(adaptor.finished());
+  ASSERT_TRUE(adaptor.children().back()->finished());
+}
+
+TEST(SequenceAdaptorTest, Repeat) {
+  double value1 = 0.0;
+  double value2 = 0.0;
+  SequenceAdaptor<Frame> adaptor({
+    Step(&value1, 1.0, Frame(2)),
+    Step(&value2, 1.0, Frame(2)),
+  });
+  adaptor.set_repeat(2);
+  adaptor.start(Frame(0));
+  // Every cycle replays the children from their starting values
+  const double expected1[] = {
+    0.0, 0.5, 1.0, 1.0, 0.0, 0.5, 1.0, 1.0, 0.0, 0.5, 1.0, 1.0, 1.0
+  };
+  const double expected2[] = {
+    0.0, 0.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.5, 1.0
+  };
+  for (int i = 0; i <= 12; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_EQ(value1, expected1[i]);
+    ASSERT_EQ(value2, expected2[i]);
+  }
+  ASSERT_TRUE(adaptor.finished());
+}
+
+TEST(SequenceAdaptorTest, Yoyo) {
+  double value1 = 0.0;
+  double value2 = 0.0;
+  SequenceAdaptor<Frame> adaptor({
+    Step(&value1, 1.0, Frame(2)),
+    Step(&value2, 1.0, Frame(2)),
+  });
+  adaptor.set_repeat(1);
+  adaptor.set_yoyo(true);
+  adaptor.start(Frame(0));
+  // The second cycle runs the children backwards in reverse order
+  const double expected1[] = {0.0, 0.5, 1.0, 1.0, 1.0, 1.0, 1.0, 0.5, 0.0};
+  const double expected2[] = {0.0, 0.0, 0.0, 0.5, 1.0, 0.5, 0.0, 0.0, 0.0};
+  for (int i = 0; i <= 8; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_EQ(value1, expected1[i]);
+    ASSERT_EQ(value2, expected2[i]);
+  }
+  ASSERT_TRUE(adaptor.finished());
+  ASSERT_EQ(adaptor.current(), 0);
+}
+
+TEST(SequenceAdaptorTest, Timeline) {
+  Timeline<Frame> timeline;
+  double value = 0.0;
+  int callbacks = 0;
+  const auto tween = timeline.tween(std::make_shared<SequenceAdaptor<Frame>>(
+      SequenceAdaptor<Frame>::Children{
+        Step(&value, 1.0, Frame(1)),
+        Step(&value, 3.0, Frame(2)),
+      },
+      LinearEasing::In, Frame(), [&callbacks]() { ++callbacks; }));
+  ASSERT_TRUE(tween.running());
+  ASSERT_TRUE(timeline.contains(tween.adaptor()));
+  ASSERT_FALSE(timeline.contains(&value));
+  const double expected[] = {1.0, 2.0, 3.0};
+  for (const auto value_expected : expected) {
+    timeline.advance();
+    ASSERT_EQ(value, value_expected);
+  }
+  ASSERT_TRUE(tween.finished());
+  ASSERT_EQ(callbacks, 1);
+}
+
+TEST(SequenceAdaptorTest, ParallelTimeline) {
+  Timeline<Frame> timeline;
+  timeline.set_concurrency(4);
+  std::vector<double> values(100);
+  for (auto& value : values) {
+    const auto adaptor = std::make_shared<SequenceAdaptor<Frame>>(
+        SequenceAdaptor<Frame>::Children{Step(&value, 1.0, Frame(1)),
+                                         Step(&value, 3.0, Frame(2))},
+        LinearEasing::In, Frame(), nullptr);
+    ASSERT_FALSE(adaptor->concurrent());
+    timeline.tween(adaptor);
+  }
+  const double expected[] = {1.0, 2.0, 3.0};
+  for (const auto value_expected : expected) {
+    timeline.advance();
+    for (const auto value : values) {
+      ASSERT_EQ(value, value_expected);
+    }
+  }
+  ASSERT_TRUE(timeline.empty());
+}
+
+TEST(SequenceAdaptorTest, Subclass) {
+  class CountingAdaptor : public SequenceAdaptor<Frame> {
+   public:
+    CountingAdaptor(const Children& children, int *count)
+        : SequenceAdaptor<Frame>(children, LinearEasing::In, Frame(), nullptr),
+          count_(count) {}
+
+   protected:
+    void update(Unit unit) override {
+      ++*count_;
+      SequenceAdaptor<Frame>::update(unit);
+    }
+
+   private:
+    int *count_;
+  };
+
+  Timeline<Frame> timeline;
+  double value = 0.0;
+  int count = 0;
+  const auto adaptor = std::make_shared<CountingAdaptor>(
+      CountingAdaptor::Children{Step(&value, 1.0, Frame(1)),
+                                Step(&value, 3.0, Frame(2))},
+      &count);
+  ASSERT_FALSE(adaptor->batch());
+  const auto tween = timeline.tween(adaptor);
+  for (int i = 0; i < 3; ++i) {
+    timeline.advance();
+  }
+  // The timeline calls the override instead of the batch update
+  ASSERT_GE(count, 3);
+  ASSERT_EQ(value, 3.0);
+  ASSERT_TRUE(tween.finished());
+}
+
+}  // namespace tween
+}  // namespace takram
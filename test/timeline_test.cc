@@ -24,8 +24,10 @@
 //  DEALINGS IN THE SOFTWARE.
 //
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -100,6 +102,229 @@ TYPED_TEST(TimelineTest, AddingAndRemoving) {
   ASSERT_EQ(timeline.empty(), true);
 }
 
+TEST(TimelineTest, ManyTargets) {
+  Timeline<Frame> timeline;
+  std::vector<double> values(100);
+  std::vector<std::shared_ptr<PointerAdaptor<Frame, double>>> adaptors;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    adaptors.emplace_back(std::make_shared<PointerAdaptor<Frame, double>>(
+        &values.at(i), 1.0, LinearEasing::In, Frame(i % 10 + 1), Frame(),
+        nullptr));
+    timeline.add(adaptors.back());
+  }
+  for (std::size_t i = 0; i < values.size(); i += 2) {
+    timeline.remove(&values.at(i));
+  }
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(timeline.contains(adaptors.at(i)), i % 2 != 0);
+    adaptors.at(i)->start(timeline.now());
+  }
+  while (!timeline.empty()) {
+    timeline.advance();
+  }
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values.at(i), i % 2 != 0 ? 1.0 : 0.0);
+  }
+}
+
+TEST(TimelineTest, MixedGroups) {
+  Timeline<Frame> timeline;
+  double value1 = 0.0;
+  double value2 = 0.0;
+  float value3 = 0.0;
+  float value4 = 0.0;
+  const std::vector<std::shared_ptr<Adaptor<Frame>>> adaptors{
+    std::make_shared<PointerAdaptor<Frame, double>>(
+        &value1, 1.0, LinearEasing::In, Frame(10), Frame(), nullptr),
+    std::make_shared<PointerAdaptor<Frame, double>>(
+        &value2, 2.0, QuadraticEasing::Out, Frame(20), Frame(), nullptr),
+    std::make_shared<PointerAdaptor<Frame, float>>(
+        &value3, 3.0, LinearEasing::In, Frame(30), Frame(), nullptr),
+    std::make_shared<PointerAdaptor<Frame, float>>(
+        &value4, 4.0, QuadraticEasing::Out, Frame(40), Frame(5), nullptr),
+  };
+  for (const auto& adaptor : adaptors) {
+    timeline.add(adaptor);
+    adaptor->start(timeline.now());
+  }
+  for (int i = 0; i < 5; ++i) {
+    timeline.advance();
+  }
+  ASSERT_EQ(value1, 0.5);
+  ASSERT_EQ(value4, 0.0);
+  while (!timeline.empty()) {
+    timeline.advance();
+  }
+  ASSERT_EQ(value1, 1.0);
+  ASSERT_EQ(value2, 2.0);
+  ASSERT_EQ(value3, 3.0);
+  ASSERT_EQ(value4, 4.0);
+  for (const auto& adaptor : adaptors) {
+    ASSERT_EQ(adaptor->finished(), true);
+  }
+}
+
+TEST(TimelineTest, SleepingAdaptors) {
+  Timeline<Frame> timeline;
+  std::vector<double> values(100);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    timeline.tween(&values.at(i), 1.0, LinearEasing::In,
+                   Frame(10), Frame(i + 1));
+  }
+  for (int i = 0; i < 50; ++i) {
+    timeline.advance();
+  }
+  // Sleeping adaptors take their starting values when they wake up
+  for (std::size_t i = 50; i < values.size(); ++i) {
+    values.at(i) = 0.5;
+  }
+  for (int i = 0; i < 5; ++i) {
+    timeline.advance();
+  }
+  ASSERT_EQ(values.at(44), 1.0);
+  ASSERT_EQ(values.at(49), 0.5);
+  ASSERT_EQ(values.at(50), 0.5 + 0.5 * 0.4);
+  ASSERT_EQ(values.at(54), 0.5);
+  timeline.remove(&values.at(99));
+  while (!timeline.empty()) {
+    timeline.advance();
+  }
+  for (std::size_t i = 0; i < values.size() - 1; ++i) {
+    ASSERT_EQ(values.at(i), 1.0);
+  }
+  ASSERT_EQ(values.at(99), 0.5);
+}
+
+TEST(TimelineTest, ScheduledTimers) {
+  Timeline<Frame> timeline;
+  const auto start = timeline.now();
+  std::vector<std::int64_t> expirations;
+  std::vector<Timer<Frame>> timers;
+  for (std::int64_t i = 0; i < 100; ++i) {
+    const auto duration = (i * 37) % 100 + 1;
+    timers.emplace_back(timeline.timer(
+        Frame(duration), [&timeline, &expirations, start]() {
+          expirations.emplace_back((timeline.now() - start).count());
+        }));
+  }
+  // Stopped timers must not expire
+  timers.at(0).stop();
+  timers.at(1).adaptor()->set_duration(Frame(200));
+  while (!timeline.empty()) {
+    timeline.advance();
+  }
+  ASSERT_EQ(timeline.now(), start + Frame(200));
+  ASSERT_EQ(expirations.size(), 99);
+  ASSERT_EQ(std::is_sorted(expirations.begin(), expirations.end()), true);
+  ASSERT_EQ(expirations.front(), 2);
+  ASSERT_EQ(expirations.back(), 200);
+  ASSERT_EQ(timers.at(0).finished(), false);
+  ASSERT_EQ(timers.at(1).finished(), true);
+}
+
+TEST(TimelineTest, ParallelAdvance) {
+  Timeline<Frame> timeline;
+  ASSERT_EQ(timeline.concurrency(), 1);
+  timeline.set_concurrency(4);
+  ASSERT_EQ(timeline.concurrency(), 4);
+  std::vector<double> values(10000);
+  std::atomic<std::size_t> finished(0);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    timeline.tween(&values.at(i), 1.0, LinearEasing::In,
+                   Frame(i % 20 + 10), Frame(i % 5), [&finished]() {
+                     ++finished;
+                   });
+  }
+  for (int i = 0; i < 10; ++i) {
+    timeline.advance();
+  }
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const auto elapsed = std::max<std::int64_t>(10 - i % 5, 0);
+    ASSERT_EQ(values.at(i),
+              static_cast<double>(elapsed) / static_cast<double>(i % 20 + 10));
+  }
+  while (!timeline.empty()) {
+    timeline.advance();
+  }
+  timeline.set_concurrency(1);
+  ASSERT_EQ(timeline.concurrency(), 1);
+  ASSERT_EQ(finished, values.size());
+  for (const auto& value : values) {
+    ASSERT_EQ(value, 1.0);
+  }
+}
+
+TEST(TimelineTest, QueuedCommands) {
+  Timeline<Frame> timeline;
+  timeline.set_owner(std::this_thread::get_id());
+  ASSERT_EQ(timeline.owner(), std::this_thread::get_id());
+  std::vector<double> values(1000);
+  std::vector<Tween<Frame>> tweens;
+  for (auto& value : values) {
+    tweens.emplace_back(&value, 1.0, LinearEasing::In, Frame(10), &timeline);
+  }
+  std::thread([&tweens]() {
+    for (auto& tween : tweens) {
+      tween.start();
+    }
+  }).join();
+  // Starting from other threads takes effect on the next advance
+  ASSERT_EQ(timeline.empty(), true);
+  timeline.advance();
+  for (const auto& tween : tweens) {
+    ASSERT_EQ(tween.running(), true);
+    ASSERT_EQ(timeline.contains(tween.adaptor()), true);
+  }
+  std::thread([&tweens]() {
+    for (std::size_t i = 0; i < tweens.size(); i += 2) {
+      tweens.at(i).stop();
+    }
+  }).join();
+  while (!timeline.empty()) {
+    timeline.advance();
+  }
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values.at(i), i % 2 ? 1.0 : 0.1);
+  }
+}
+
+TEST(TimelineTest, CallbackDispatch) {
+  Timeline<Frame> timeline;
+  int called = 0;
+  const auto callback = [&called]() { ++called; };
+  double value1 = 0.0;
+  double value2 = 0.0;
+  double value3 = 0.0;
+  timeline.tween(&value1, 1.0, LinearEasing::In, Frame(1), callback);
+  timeline.advance();
+  ASSERT_EQ(called, 1);
+
+  // Deferred to the next advance
+  timeline.set_callbacks_deferred(true);
+  ASSERT_EQ(timeline.callbacks_deferred(), true);
+  timeline.tween(&value2, 1.0, LinearEasing::In, Frame(1), callback);
+  timeline.advance();
+  ASSERT_EQ(called, 1);
+  timeline.advance();
+  ASSERT_EQ(called, 2);
+  timeline.set_callbacks_deferred(false);
+
+  // Handed to an executor
+  std::vector<Callback> callbacks;
+  timeline.set_executor([&callbacks](const Callback& callback) {
+    callbacks.emplace_back(callback);
+  });
+  ASSERT_EQ(static_cast<bool>(timeline.executor()), true);
+  timeline.tween(&value3, 1.0, LinearEasing::In, Frame(1), callback);
+  timeline.advance();
+  ASSERT_EQ(called, 2);
+  ASSERT_EQ(callbacks.size(), 1);
+  callbacks.front()();
+  ASSERT_EQ(called, 3);
+  timeline.set_executor(nullptr);
+  ASSERT_EQ(static_cast<bool>(timeline.executor()), false);
+}
+
 TEST(TimelineTest, TimeAdvance) {
   Timeline<Time> timeline;
   std::mutex mutex;
@@ -253,5 +478,189 @@ TEST(TimelineTest, RecursiveAdding) {
   ASSERT_EQ(order.at(3), &value4);
 }
 
+TEST(TimelineTest, RepeatingTween) {
+  Timeline<Frame> timeline;
+  double value = 0.0;
+  bool callbacked = false;
+  auto tween = Tween<Frame>(&value, 2.0, LinearEasing::In, Frame(2),
+                            [&callbacked]() { callbacked = true; },
+                            &timeline);
+  tween.set_repeat(1);
+  tween.set_yoyo(true);
+  tween.start();
+  const double expected[] = {1.0, 2.0, 1.0, 0.0};
+  for (const auto expected_value : expected) {
+    ASSERT_TRUE(timeline.contains(&value));
+    timeline.advance();
+    ASSERT_EQ(value, expected_value);
+  }
+  ASSERT_TRUE(callbacked);
+  ASSERT_TRUE(timeline.empty());
+}
+
+TEST(TimelineTest, Seek) {
+  Timeline<Frame> timeline;
+  const auto start = timeline.now();
+  std::vector<double> values(100);
+  for (auto& value : values) {
+    timeline.tween(&value, 10.0, LinearEasing::In, Frame(10));
+  }
+  timeline.seek(start + Frame(5));
+  ASSERT_EQ(timeline.now(), start + Frame(5));
+  for (const auto value : values) {
+    ASSERT_EQ(value, 5.0);
+  }
+  timeline.seek(start + Frame(2));
+  for (const auto value : values) {
+    ASSERT_EQ(value, 2.0);
+  }
+  timeline.advance();
+  for (const auto value : values) {
+    ASSERT_EQ(value, 3.0);
+  }
+  timeline.seek(start + Frame(10));
+  for (const auto value : values) {
+    ASSERT_EQ(value, 10.0);
+  }
+  // Adaptors sought past their ends finish on the next advance
+  ASSERT_FALSE(timeline.empty());
+  timeline.advance();
+  ASSERT_TRUE(timeline.empty());
+}
+
+TEST(TimelineTest, SeekBackAndForth) {
+  Timeline<Frame> timeline;
+  const auto start = timeline.now();
+  double value = 0.0;
+  timeline.tween(&value, 10.0, LinearEasing::In, Frame(10), Frame(5));
+  timeline.seek(start + Frame(10));
+  ASSERT_EQ(value, 5.0);
+  timeline.seek(start + Frame(2));
+  ASSERT_EQ(value, 0.0);
+  timeline.seek(start + Frame(10));
+  ASSERT_EQ(value, 5.0);
+  timeline.seek(start + Frame(12));
+  ASSERT_EQ(value, 7.0);
+  timeline.seek(start + Frame(8));
+  ASSERT_EQ(value, 3.0);
+  timeline.seek(start + Frame(4));
+  timeline.advance();
+  ASSERT_EQ(value, 0.0);
+  timeline.advance();
+  ASSERT_EQ(value, 1.0);
+
+  // Seeking past the end holds the end values without finishing
+  double other = 0.0;
+  int callbacks = 0;
+  const auto begin = timeline.now();
+  const auto tween = timeline.tween(
+      &other, 20.0, LinearEasing::In, Frame(10), Frame(),
+      [&callbacks]() { ++callbacks; });
+  timeline.seek(begin + Frame(20));
+  ASSERT_EQ(other, 20.0);
+  ASSERT_FALSE(tween.finished());
+  ASSERT_EQ(callbacks, 0);
+  timeline.seek(begin + Frame(5));
+  ASSERT_EQ(other, 10.0);
+  timeline.seek(begin + Frame(30));
+  ASSERT_EQ(other, 20.0);
+  timeline.advance();
+  ASSERT_TRUE(tween.finished());
+  ASSERT_EQ(callbacks, 1);
+  ASSERT_TRUE(timeline.empty());
+  timeline.seek(begin + Frame(5));
+  ASSERT_EQ(other, 20.0);
+}
+
+TEST(TimelineTest, Playback) {
+  Timeline<Frame> timeline;
+  const auto start = timeline.now();
+  double value = 0.0;
+  timeline.tween(&value, 4.0, LinearEasing::In, Frame(4));
+  timeline.pause();
+  ASSERT_TRUE(timeline.paused());
+  timeline.advance();
+  ASSERT_EQ(timeline.now(), start);
+  ASSERT_EQ(value, 0.0);
+  timeline.resume();
+  timeline.set_rate(2.0);
+  ASSERT_EQ(timeline.rate(), 2.0);
+  timeline.advance();
+  ASSERT_EQ(timeline.now(), start + Frame(2));
+  ASSERT_EQ(value, 2.0);
+}
+
+TEST(TimelineTest, FixedStep) {
+  Timeline<Frame> timeline;
+  const auto start = timeline.now();
+  double value = 0.0;
+  timeline.set_fixed_step(Frame(2));
+  ASSERT_EQ(timeline.fixed_step(), Frame(2));
+  timeline.tween(&value, 4.0, LinearEasing::In, Frame(4));
+  timeline.advance();
+  ASSERT_EQ(timeline.now(), start);
+  ASSERT_EQ(timeline.alpha(), 0.5);
+
+  // Advances short of a step leave the adaptors as they are
+  value = -1.0;
+  timeline.advance();
+  ASSERT_EQ(timeline.now(), start + Frame(2));
+  ASSERT_EQ(value, 2.0);
+  value = -1.0;
+  timeline.advance();
+  ASSERT_EQ(value, -1.0);
+  timeline.advance();
+  ASSERT_EQ(value, 4.0);
+  ASSERT_TRUE(timeline.empty());
+}
+
+TEST(TimelineTest, AdvanceToTime) {
+  Clock<Time> clock;
+  std::vector<Timeline<Time>> timelines(3);
+  std::vector<double> values(timelines.size());
+  for (std::size_t i = 0; i < timelines.size(); ++i) {
+    timelines[i].advance(clock.now());
+    timelines[i].tween(&values[i], 1.0, LinearEasing::In, Time(10.0));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  const auto now = clock.advance();
+  for (auto& timeline : timelines) {
+    ASSERT_EQ(timeline.advance(now), now);
+  }
+  ASSERT_GT(values.front(), 0.0);
+  ASSERT_LT(values.front(), 1.0);
+  for (const auto& value : values) {
+    ASSERT_EQ(value, values.front());
+  }
+  const auto end = now + Time(10.0);
+  for (auto& timeline : timelines) {
+    timeline.advance(end);
+    ASSERT_TRUE(timeline.empty());
+  }
+  for (const auto& value : values) {
+    ASSERT_EQ(value, 1.0);
+  }
+}
+
+TEST(TimelineTest, ReleaseEasings) {
+  Timeline<Frame> timeline;
+  const auto state = std::make_shared<Unit>(1.0);
+  double values[2] = {};
+  for (auto& value : values) {
+    timeline.tween(&value, 1.0, [state](Unit parameter) {
+      return parameter * *state;
+    }, Frame(1));
+  }
+  ASSERT_GT(state.use_count(), 1);
+  timeline.advance();
+  timeline.advance();
+  ASSERT_TRUE(timeline.empty());
+  ASSERT_EQ(values[0], 1.0);
+  ASSERT_EQ(values[1], 1.0);
+
+  // Empty groups no longer hold the easings of their last adaptors
+  ASSERT_EQ(state.use_count(), 1);
+}
+
 }  // namespace tween
 }  // namespace takram
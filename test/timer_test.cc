@@ -24,7 +24,9 @@
 //  DEALINGS IN THE SOFTWARE.
 //
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -35,6 +37,25 @@
 namespace takram {
 namespace tween {
 
+namespace {
+
+class CountingTimerAdaptor : public TimerAdaptor<Frame> {
+ public:
+  explicit CountingTimerAdaptor(int *count)
+      : TimerAdaptor<Frame>(Frame(5), nullptr),
+        count_(count) {}
+
+ protected:
+  void update(Unit) override {
+    ++*count_;
+  }
+
+ private:
+  int *count_;
+};
+
+}  // namespace
+
 template <class T>
 class TimerTest : public ::testing::Test {};
 
@@ -92,5 +113,50 @@ TYPED_TEST(TimerTest, ConstructibleWithPointer) {
   ASSERT_EQ(timer.timeline(), &timeline);
 }
 
+TYPED_TEST(TimerTest, StableHash) {
+  TimerAdaptor<TypeParam> adaptor1(TypeParam(), nullptr);
+  TimerAdaptor<TypeParam> adaptor2(TypeParam(), nullptr);
+  ASSERT_EQ(adaptor1.object_hash(), adaptor1.object_hash());
+  ASSERT_EQ(adaptor1.target_hash(), adaptor1.target_hash());
+  ASSERT_NE(adaptor1.object_hash(), adaptor2.object_hash());
+  ASSERT_NE(adaptor1.target_hash(), adaptor2.target_hash());
+}
+
+TYPED_TEST(TimerTest, StartAndStopMany) {
+  Timeline<TypeParam> timeline;
+  std::vector<Timer<TypeParam>> timers;
+  for (std::size_t i = 0; i < 10000; ++i) {
+    timers.emplace_back(timeline.timer(TypeParam(1000)));
+  }
+  for (const auto& timer : timers) {
+    ASSERT_EQ(timer.running(), true);
+    ASSERT_EQ(timeline.contains(timer.adaptor()), true);
+  }
+  for (auto& timer : timers) {
+    timer.stop();
+    ASSERT_EQ(timeline.contains(timer.adaptor()), false);
+  }
+  ASSERT_EQ(timeline.empty(), true);
+}
+
+TEST(TimerTest, Subclass) {
+  Timeline<Frame> timeline;
+  int count = 0;
+  const auto adaptor = std::make_shared<CountingTimerAdaptor>(&count);
+  ASSERT_FALSE(adaptor->batch());
+  ASSERT_FALSE(adaptor->deferrable());
+  Timer<Frame> timer(adaptor, &timeline);
+  timer.start();
+  for (int i = 0; i < 5; ++i) {
+    timeline.advance();
+  }
+  // Subclasses are updated every frame instead of waiting for the deadline
+  ASSERT_GE(count, 5);
+  ASSERT_TRUE(timer.finished());
+  const TimerAdaptor<Frame> base(Frame(1), nullptr);
+  ASSERT_TRUE(base.batch());
+  ASSERT_TRUE(base.deferrable());
+}
+
 }  // namespace tween
 }  // namespace takram
@@ -0,0 +1,172 @@
+//
+//  track_adaptor_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "takram/easing.h"
+#include "takram/tween/interval.h"
+#include "takram/tween/keyframe.h"
+#include "takram/tween/timeline.h"
+#include "takram/tween/track_adaptor.h"
+
+namespace takram {
+namespace tween {
+
+template <class T>
+class TrackAdaptorTest : public ::testing::Test {};
+
+using Types = ::testing::Types<
+  Time,
+  Frame
+>;
+TYPED_TEST_CASE(TrackAdaptorTest, Types);
+
+TYPED_TEST(TrackAdaptorTest, Constructible) {
+  double value = 0.0;
+  const std::vector<Keyframe<double>> keyframes{{0.0, 1.0}, {1.0, 2.0}};
+  const auto adaptor = TrackAdaptor<TypeParam, double>(
+      &value, keyframes, Interpolation::CUBIC, LinearEasing::In,
+      TypeParam(), TypeParam(), nullptr);
+  ASSERT_EQ(adaptor.target(), &value);
+  ASSERT_EQ(adaptor.keyframes().size(), 2);
+  ASSERT_EQ(adaptor.interpolation(), Interpolation::CUBIC);
+  ASSERT_EQ(adaptor.segment(), 0);
+  ASSERT_EQ(adaptor.object_hash(), Hash(&value));
+  ASSERT_EQ(adaptor.target_hash(), Hash(&value));
+}
+
+TYPED_TEST(TrackAdaptorTest, EmptyDuration) {
+  double value = 0.0;
+  auto adaptor = TrackAdaptor<TypeParam, double>(
+      &value, {{0.0, 1.0}, {0.5, 2.0}, {1.0, 3.0}}, Interpolation::LINEAR,
+      LinearEasing::In, TypeParam(), TypeParam(), nullptr);
+  adaptor.start(TypeParam());
+  adaptor.update(TypeParam());
+  ASSERT_EQ(value, 3.0);
+  ASSERT_TRUE(adaptor.finished());
+}
+
+TEST(TrackAdaptorTest, Linear) {
+  double value = 0.0;
+  auto adaptor = TrackAdaptor<Frame, double>(
+      &value, {{0.0, 0.0}, {0.5, 10.0}, {1.0, 0.0}}, Interpolation::LINEAR,
+      LinearEasing::In, Frame(10), Frame(), nullptr);
+  adaptor.start(Frame(0));
+  const double expected[] = {0, 2, 4, 6, 8, 10, 8, 6, 4, 2, 0};
+  for (int i = 0; i <= 10; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_DOUBLE_EQ(value, expected[i]);
+    ASSERT_EQ(adaptor.segment(), i < 5 ? 0 : 1);
+  }
+  ASSERT_TRUE(adaptor.finished());
+}
+
+TEST(TrackAdaptorTest, SegmentEasing) {
+  double value = 0.0;
+  auto adaptor = TrackAdaptor<Frame, double>(
+      &value, {{0.0, 0.0, QuadraticEasing::In}, {0.5, 1.0}, {1.0, 2.0}},
+      Interpolation::LINEAR, LinearEasing::In, Frame(4), Frame(), nullptr);
+  adaptor.start(Frame(0));
+  adaptor.update(Frame(1));
+  ASSERT_DOUBLE_EQ(value, 0.25);
+  adaptor.update(Frame(3));
+  ASSERT_DOUBLE_EQ(value, 1.5);
+}
+
+TEST(TrackAdaptorTest, Seek) {
+  double value = 0.0;
+  std::vector<Keyframe<double>> keyframes;
+  for (int i = 0; i <= 10; ++i) {
+    keyframes.push_back({i / 10.0, i * 10.0});
+  }
+  auto adaptor = TrackAdaptor<Frame, double>(
+      &value, keyframes, Interpolation::LINEAR,
+      LinearEasing::In, Frame(100), Frame(), nullptr);
+  adaptor.start(Frame(0));
+  adaptor.update(Frame(85));
+  ASSERT_EQ(adaptor.segment(), 8);
+  ASSERT_DOUBLE_EQ(value, 85.0);
+  adaptor.update(Frame(15));
+  ASSERT_EQ(adaptor.segment(), 1);
+  ASSERT_DOUBLE_EQ(value, 15.0);
+}
+
+TEST(TrackAdaptorTest, SeekBackAndForth) {
+  Timeline<Frame> timeline;
+  const auto start = timeline.now();
+  double value = 0.0;
+  const std::vector<Keyframe<double>> keyframes{{0.0, 2.0}, {1.0, 12.0}};
+  timeline.tween(&value, keyframes, Interpolation::LINEAR,
+                 Frame(10), Frame(5));
+  timeline.seek(start + Frame(2));
+  ASSERT_EQ(value, 0.0);
+  timeline.seek(start + Frame(10));
+  ASSERT_EQ(value, 7.0);
+  timeline.seek(start + Frame(2));
+  ASSERT_EQ(value, 2.0);
+  timeline.seek(start + Frame(12));
+  ASSERT_EQ(value, 9.0);
+  timeline.seek(start + Frame(8));
+  ASSERT_EQ(value, 5.0);
+}
+
+TEST(TrackAdaptorTest, Cubic) {
+  double value = 0.0;
+  auto adaptor = TrackAdaptor<Frame, double>(
+      &value, {{0.0, 0.0}, {0.25, 1.0}, {0.5, 0.0}, {0.75, 1.0}, {1.0, 0.0}},
+      Interpolation::CUBIC, LinearEasing::In, Frame(8), Frame(), nullptr);
+  adaptor.start(Frame(0));
+  // Passes through the keyframes. The end segments repeat the end keyframes
+  // for their missing neighbours.
+  const double expected[] = {0, 0.5625, 1, 0.5, 0, 0.5, 1, 0.5625, 0};
+  for (int i = 0; i <= 8; ++i) {
+    adaptor.update(Frame(i));
+    ASSERT_DOUBLE_EQ(value, expected[i]);
+  }
+}
+
+TEST(TrackAdaptorTest, Tween) {
+  Timeline<Frame> timeline;
+  double value = 0.0;
+  const std::vector<Keyframe<double>> keyframes{{0.0, 1.0}, {1.0, 3.0}};
+  const auto start = timeline.now();
+  const auto tween = timeline.tween(
+      &value, keyframes, Interpolation::LINEAR, Frame(2));
+  ASSERT_TRUE(tween.running());
+  timeline.advance();
+  ASSERT_EQ(timeline.now(), start + Frame(1));
+  ASSERT_DOUBLE_EQ(value, 2.0);
+  timeline.advance();
+  ASSERT_DOUBLE_EQ(value, 3.0);
+  ASSERT_TRUE(tween.finished());
+}
+
+}  // namespace tween
+}  // namespace takram
@@ -0,0 +1,126 @@
+//
+//  transform_test.cc
+//
+//  The MIT License
+//
+//  Copyright (C) 2014-2015 Shota Matsuda
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+
+#include <array>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "takram/tween/easing.h"
+#include "takram/tween/interval.h"
+#include "takram/tween/pointer_adaptor.h"
+#include "takram/tween/quaternion.h"
+#include "takram/tween/transform.h"
+
+namespace takram {
+namespace tween {
+
+namespace {
+
+struct Point {
+  double x;
+  double y;
+};
+
+}  // namespace
+
+template <>
+struct Transform<Point> {
+  Point operator()(Unit unit, const Point& from, const Point& to) const {
+    return {from.x + (to.x - from.x) * unit, from.y + (to.y - from.y) * unit};
+  }
+};
+
+TEST(TransformTest, Arithmetic) {
+  ASSERT_EQ(transform(LinearEasing::In, 0.5, 0.0, 2.0), 1.0);
+  ASSERT_EQ(transform(LinearEasing::In, 0.5, 0.0f, 2.0f), 1.0f);
+  ASSERT_EQ(transform(LinearEasing::In, 0.5, 0, 10), 5);
+  ASSERT_EQ(transform(QuadraticEasing::In, 0.5, 0.0, 4.0), 1.0);
+  static_assert(Transform<double>()(0.5, 0.0, 2.0) == 1.0, "");
+}
+
+TEST(TransformTest, Customization) {
+  const auto point = transform(LinearEasing::In, 0.5,
+                               Point{0.0, 2.0}, Point{2.0, 0.0});
+  ASSERT_EQ(point.x, 1.0);
+  ASSERT_EQ(point.y, 1.0);
+  Point target{};
+  PointerAdaptor<Frame, Point> adaptor(
+      &target, Point{4.0, 8.0}, LinearEasing::In, Frame(4), Frame(), nullptr);
+  adaptor.start(Frame());
+  adaptor.update(Frame(1));
+  ASSERT_EQ(target.x, 1.0);
+  ASSERT_EQ(target.y, 2.0);
+}
+
+TEST(TransformTest, Array) {
+  using Vector = std::array<float, 7>;
+  const Vector from{{0, 1, 2, 3, 4, 5, 6}};
+  const Vector to{{2, 3, 4, 5, 6, 7, 8}};
+  const auto vector = transform(LinearEasing::In, 0.5, from, to);
+  for (std::size_t i = 0; i < vector.size(); ++i) {
+    ASSERT_EQ(vector[i], from[i] + 1);
+  }
+  using Color = std::array<unsigned char, 4>;
+  const auto color = transform(LinearEasing::In, 0.5,
+                               Color{{0, 0, 0, 255}},
+                               Color{{255, 128, 64, 255}});
+  ASSERT_EQ(color[0], 127);
+  ASSERT_EQ(color[1], 64);
+  ASSERT_EQ(color[2], 32);
+  ASSERT_EQ(color[3], 255);
+  std::array<double, 4> target{{}};
+  PointerAdaptor<Frame, std::array<double, 4>> adaptor(
+      &target, std::array<double, 4>{{4, 8, 12, 16}},
+      LinearEasing::In, Frame(4), Frame(), nullptr);
+  adaptor.start(Frame());
+  adaptor.update(Frame(1));
+  ASSERT_EQ(target, (std::array<double, 4>{{1, 2, 3, 4}}));
+}
+
+TEST(TransformTest, Quaternion) {
+  const auto half = std::sqrt(0.5);
+  const Quaternion<double> from{0, 0, 0, 1};
+  const Quaternion<double> to{0, 0, 1, 0};
+  auto rotation = transform(LinearEasing::In, 0.5, from, to);
+  ASSERT_NEAR(rotation.z, half, 1e-12);
+  ASSERT_NEAR(rotation.w, half, 1e-12);
+  rotation = transform(LinearEasing::In, 1.0 / 3.0, from, to);
+  ASSERT_NEAR(rotation.z, 0.5, 1e-12);
+  ASSERT_NEAR(rotation.w, std::sqrt(0.75), 1e-12);
+
+  // Shortest arc
+  rotation = transform(LinearEasing::In, 0.5, from,
+                       Quaternion<double>{0, 0, -1, 0});
+  ASSERT_NEAR(rotation.z, -half, 1e-12);
+  ASSERT_NEAR(rotation.w, half, 1e-12);
+  rotation = transform(LinearEasing::In, 0.5, from,
+                       Quaternion<double>{0, 0, 0, -1});
+  ASSERT_NEAR(rotation.w, 1.0, 1e-12);
+}
+
+}  // namespace tween
+}  // namespace takram